@@ -0,0 +1,108 @@
+description(
+"Tests that Array.prototype slice, splice, concat and indexOf give the same results on arrays that leave their dense fast paths (holes, sparse storage, non-extensible arrays, and getters on the prototype) as the generic path does."
+);
+
+debug("Dense arrays");
+var dense = [0, 1, 2, 3, 4];
+shouldBe("String(dense.slice(1, 4))", "'1,2,3'");
+shouldBe("String(dense.slice(-2))", "'3,4'");
+shouldBe("dense.slice(3, 1).length", "0");
+shouldBe("String(dense.concat([5, 6], 7))", "'0,1,2,3,4,5,6,7'");
+shouldBe("dense.indexOf(3)", "3");
+shouldBe("dense.indexOf(3, 4)", "-1");
+shouldBe("dense.indexOf('3')", "-1");
+shouldBe("[NaN].indexOf(NaN)", "-1");
+var spliced = dense.slice();
+shouldBe("String(spliced.splice(1, 2))", "'1,2'");
+shouldBe("String(spliced)", "'0,3,4'");
+shouldBe("String(spliced.splice(1, 0, 'a', 'b'))", "''");
+shouldBe("String(spliced)", "'0,a,b,3,4'");
+shouldBe("String(spliced.splice(1, 2, 'c'))", "'a,b'");
+shouldBe("String(spliced)", "'0,c,3,4'");
+
+debug("");
+debug("Arrays with holes");
+var holey = [0, 1, , 3, 4];
+shouldBe("holey.slice(1, 4).length", "3");
+shouldBeFalse("1 in holey.slice(1, 4)");
+shouldBe("holey.concat([5]).length", "6");
+shouldBeFalse("2 in holey.concat([5])");
+shouldBe("holey.concat([5])[5]", "5");
+shouldBe("holey.indexOf(undefined)", "-1");
+shouldBe("holey.indexOf(4)", "4");
+shouldBe("holey.slice().splice(1, 2).length", "2");
+shouldBeFalse("1 in holey.slice().splice(1, 2)");
+var holeySpliced = holey.slice();
+holeySpliced.splice(0, 1);
+shouldBe("holeySpliced.length", "4");
+shouldBeFalse("1 in holeySpliced");
+shouldBe("String(holeySpliced)", "'1,,3,4'");
+holeySpliced = holey.slice();
+holeySpliced.splice(1, 0, 'x');
+shouldBe("holeySpliced.length", "6");
+shouldBeFalse("3 in holeySpliced");
+shouldBe("String(holeySpliced)", "'0,x,1,,3,4'");
+
+debug("");
+debug("Holes filled by a getter on Array.prototype");
+Object.defineProperty(Array.prototype, "2", { get: function() { return "fromPrototype"; }, configurable: true });
+shouldBe("holey.slice(1, 4)[1]", "'fromPrototype'");
+shouldBeTrue("1 in holey.slice(1, 4)");
+shouldBe("[].concat(holey)[2]", "'fromPrototype'");
+shouldBe("holey.indexOf('fromPrototype')", "2");
+var prototypeSpliced = [0, 1, , 3, 4];
+shouldBe("String(prototypeSpliced.splice(1, 3))", "'1,fromPrototype,3'");
+shouldBe("String(prototypeSpliced)", "'0,4'");
+delete Array.prototype[2];
+shouldBe("holey.indexOf('fromPrototype')", "-1");
+
+debug("");
+debug("Arrays with sparse storage");
+var sparse = [0, 1, 2];
+sparse[100000] = "far";
+shouldBe("sparse.indexOf('far')", "100000");
+shouldBe("sparse.slice(99999).length", "2");
+shouldBe("sparse.slice(99999)[1]", "'far'");
+shouldBe("[].concat(sparse).length", "100001");
+shouldBe("[].concat(sparse)[100000]", "'far'");
+shouldBe("String(sparse.splice(1, 1))", "'1'");
+shouldBe("sparse.length", "100000");
+shouldBe("sparse[99999]", "'far'");
+
+var withAccessor = [0, 1, 2, 3];
+Object.defineProperty(withAccessor, "3", { get: function() { return "getter"; }, enumerable: true, configurable: true });
+shouldBe("String(withAccessor.slice(1))", "'1,2,getter'");
+shouldBe("withAccessor.indexOf('getter')", "3");
+shouldBe("String([].concat(withAccessor))", "'0,1,2,getter'");
+shouldBe("String(withAccessor.splice(2, 2))", "'2,getter'");
+shouldBe("String(withAccessor)", "'0,1'");
+
+var withReadOnly = [0, 1, 2];
+Object.defineProperty(withReadOnly, "1", { value: "readOnly", writable: false, enumerable: true, configurable: true });
+shouldBe("String(withReadOnly.slice(0))", "'0,readOnly,2'");
+shouldBe("withReadOnly.indexOf('readOnly')", "1");
+shouldBe("String(withReadOnly.concat(3))", "'0,readOnly,2,3'");
+
+debug("");
+debug("Non-extensible arrays");
+var nonExtensible = [1, 2, 3];
+Object.preventExtensions(nonExtensible);
+shouldBe("String(nonExtensible.slice(1))", "'2,3'");
+shouldBe("nonExtensible.indexOf(3)", "2");
+shouldBe("String([0].concat(nonExtensible))", "'0,1,2,3'");
+shouldThrow("nonExtensible.unshift(0)");
+shouldBe("String(nonExtensible)", "'1,2,3'");
+shouldBeFalse("3 in nonExtensible");
+shouldThrow("nonExtensible.splice(1, 0, 'x')");
+shouldBeFalse("3 in nonExtensible");
+shouldBe("String(nonExtensible.splice(0, 1))", "'1'");
+shouldBe("String(nonExtensible)", "'2,3'");
+
+debug("");
+debug("Array-like receivers");
+var arrayLike = { 0: "a", 1: "b", 2: "c", length: 3 };
+shouldBe("String(Array.prototype.slice.call(arrayLike, 1))", "'b,c'");
+shouldBe("Array.prototype.indexOf.call(arrayLike, 'c')", "2");
+shouldBe("String(Array.prototype.splice.call(arrayLike, 0, 1))", "'a'");
+shouldBe("arrayLike.length", "2");
+shouldBe("arrayLike[0]", "'b'");
@@ -74,8 +74,10 @@ JSGlobalContextRef JSGlobalContextCreateInGroup(JSContextGroupRef group, JSClass
 {
     initializeThreading();
 
-    JSLock lock(LockForReal);
     RefPtr<JSGlobalData> globalData = group ? PassRefPtr<JSGlobalData>(toJS(group)) : JSGlobalData::createContextGroup(ThreadStackTypeSmall);
+    // Only a group that is really the shared instance needs the global JSMutex; independent groups
+    // are created concurrently the same way worker threads create their own JSGlobalData.
+    JSLock lock(globalData->isSharedInstance() ? LockForReal : SilenceAssertionsOnly);
 
     APIEntryShim entryShim(globalData.get(), false);
 
@@ -1277,27 +1277,50 @@ void CodeBlock::dump(ExecState* exec, const Vector<Instruction>::const_iterator&
 static HashSet<CodeBlock*> liveCodeBlockSet;
 #endif
 
-#define FOR_EACH_MEMBER_VECTOR(macro) \
-    macro(instructions) \
-    macro(globalResolveInfos) \
+#if ENABLE(JIT)
+#define FOR_EACH_MEMBER_VECTOR_JIT(macro) \
     macro(structureStubInfos) \
+    macro(globalResolveInfos) \
     macro(callLinkInfos) \
-    macro(linkedCallerList) \
+    macro(methodCallLinkInfos)
+#define FOR_EACH_MEMBER_VECTOR_RARE_DATA_JIT(macro) \
+    macro(callReturnIndexVector)
+#else
+#define FOR_EACH_MEMBER_VECTOR_JIT(macro)
+#define FOR_EACH_MEMBER_VECTOR_RARE_DATA_JIT(macro)
+#endif
+
+#if ENABLE(VALUE_PROFILER)
+#define FOR_EACH_MEMBER_VECTOR_VALUE_PROFILER(macro) \
+    macro(argumentValueProfiles) \
+    macro(valueProfiles) \
+    macro(rareCaseProfiles) \
+    macro(specialFastCaseProfiles)
+#else
+#define FOR_EACH_MEMBER_VECTOR_VALUE_PROFILER(macro)
+#endif
+
+#define FOR_EACH_MEMBER_VECTOR(macro) \
+    macro(instructions) \
+    macro(jumpTargets) \
+    macro(loopTargets) \
     macro(identifiers) \
-    macro(functionExpressions) \
-    macro(constantRegisters)
+    macro(functionDecls) \
+    macro(functionExprs) \
+    macro(constantRegisters) \
+    FOR_EACH_MEMBER_VECTOR_JIT(macro) \
+    FOR_EACH_MEMBER_VECTOR_VALUE_PROFILER(macro)
 
 #define FOR_EACH_MEMBER_VECTOR_RARE_DATA(macro) \
     macro(regexps) \
-    macro(functions) \
+    macro(constantBuffers) \
     macro(exceptionHandlers) \
     macro(immediateSwitchJumpTables) \
     macro(characterSwitchJumpTables) \
     macro(stringSwitchJumpTables) \
-    macro(evalCodeCache) \
     macro(expressionInfo) \
     macro(lineInfo) \
-    macro(callReturnIndexVector)
+    FOR_EACH_MEMBER_VECTOR_RARE_DATA_JIT(macro)
 
 template<typename T>
 static size_t sizeInBytes(const Vector<T>& vector)
@@ -1305,6 +1328,18 @@ static size_t sizeInBytes(const Vector<T>& vector)
     return vector.capacity() * sizeof(T);
 }
 
+template<typename T>
+static size_t sizeInBytes(const RefCountedArray<T>& array)
+{
+    return array.size() * sizeof(T);
+}
+
+template<typename T, size_t SegmentSize>
+static size_t sizeInBytes(const SegmentedVector<T, SegmentSize>& vector)
+{
+    return vector.size() * sizeof(T);
+}
+
 void CodeBlock::dumpStatistics()
 {
 #if DUMP_CODE_BLOCK_STATISTICS
@@ -1329,18 +1364,18 @@ void CodeBlock::dumpStatistics()
     for (HashSet<CodeBlock*>::const_iterator it = liveCodeBlockSet.begin(); it != end; ++it) {
         CodeBlock* codeBlock = *it;
 
-        #define GET_STATS(name) if (!codeBlock->m_##name.isEmpty()) { name##IsNotEmpty++; name##TotalSize += sizeInBytes(codeBlock->m_##name); }
+        #define GET_STATS(name) if (size_t size = sizeInBytes(codeBlock->m_##name)) { name##IsNotEmpty++; name##TotalSize += size; }
             FOR_EACH_MEMBER_VECTOR(GET_STATS)
         #undef GET_STATS
 
-        if (!codeBlock->m_symbolTable.isEmpty()) {
+        if (codeBlock->m_symbolTable && !codeBlock->m_symbolTable->isEmpty()) {
             symbolTableIsNotEmpty++;
-            symbolTableTotalSize += (codeBlock->m_symbolTable.capacity() * (sizeof(SymbolTable::KeyType) + sizeof(SymbolTable::MappedType)));
+            symbolTableTotalSize += (codeBlock->m_symbolTable->capacity() * (sizeof(SymbolTable::KeyType) + sizeof(SymbolTable::MappedType)));
         }
 
         if (codeBlock->m_rareData) {
             hasRareData++;
-            #define GET_STATS(name) if (!codeBlock->m_rareData->m_##name.isEmpty()) { name##IsNotEmpty++; name##TotalSize += sizeInBytes(codeBlock->m_rareData->m_##name); }
+            #define GET_STATS(name) if (size_t size = sizeInBytes(codeBlock->m_rareData->m_##name)) { name##IsNotEmpty++; name##TotalSize += size; }
                 FOR_EACH_MEMBER_VECTOR_RARE_DATA(GET_STATS)
             #undef GET_STATS
 
@@ -1403,6 +1438,7 @@ CodeBlock::CodeBlock(CopyParsedBlockTag, CodeBlock& other, SymbolTable* symTab)
     , m_numCalleeRegisters(other.m_numCalleeRegisters)
     , m_numVars(other.m_numVars)
     , m_numCapturedVars(other.m_numCapturedVars)
+    , m_capturesArguments(other.m_capturesArguments)
     , m_isConstructor(other.m_isConstructor)
     , m_ownerExecutable(*other.m_globalData, other.m_ownerExecutable.get(), other.m_ownerExecutable.get())
     , m_globalData(other.m_globalData)
@@ -1435,6 +1471,7 @@ CodeBlock::CodeBlock(CopyParsedBlockTag, CodeBlock& other, SymbolTable* symTab)
     , m_forcedOSRExitCounter(0)
     , m_optimizationDelayCounter(0)
     , m_reoptimizationRetryCounter(0)
+    , m_ranSinceLastCodeAgingCheck(0)
 #if ENABLE(JIT)
     , m_canCompileWithDFGState(CompileWithDFGUnset)
 #endif
@@ -1462,6 +1499,7 @@ CodeBlock::CodeBlock(ScriptExecutable* ownerExecutable, CodeType codeType, JSGlo
     , m_heap(&m_globalObject->globalData().heap)
     , m_numCalleeRegisters(0)
     , m_numVars(0)
+    , m_capturesArguments(false)
     , m_isConstructor(isConstructor)
     , m_numParameters(0)
     , m_ownerExecutable(globalObject->globalData(), ownerExecutable, ownerExecutable)
@@ -1483,6 +1521,7 @@ CodeBlock::CodeBlock(ScriptExecutable* ownerExecutable, CodeType codeType, JSGlo
     , m_speculativeFailCounter(0)
     , m_optimizationDelayCounter(0)
     , m_reoptimizationRetryCounter(0)
+    , m_ranSinceLastCodeAgingCheck(0)
 {
     ASSERT(m_source);
     
@@ -2110,6 +2149,7 @@ void CodeBlock::shrinkToFit()
     m_callLinkInfos.shrinkToFit();
 #endif
 
+    m_jumpTargets.shrinkToFit();
     m_identifiers.shrinkToFit();
     m_functionDecls.shrinkToFit();
     m_functionExprs.shrinkToFit();
@@ -2118,6 +2158,7 @@ void CodeBlock::shrinkToFit()
     if (m_rareData) {
         m_rareData->m_exceptionHandlers.shrinkToFit();
         m_rareData->m_regexps.shrinkToFit();
+        m_rareData->m_constantBuffers.shrinkToFit();
         m_rareData->m_immediateSwitchJumpTables.shrinkToFit();
         m_rareData->m_characterSwitchJumpTables.shrinkToFit();
         m_rareData->m_stringSwitchJumpTables.shrinkToFit();
@@ -859,6 +859,18 @@ namespace JSC {
             return m_llintExecuteCounter.m_counter;
         }
         
+        // Set by every execution engine whenever it enters this code block, and
+        // cleared by the periodic code aging check in the heap.
+        void didRunSinceLastCodeAgingCheck() { m_ranSinceLastCodeAgingCheck = 1; }
+        void* addressOfRanSinceLastCodeAgingCheck() { return &m_ranSinceLastCodeAgingCheck; }
+        
+        bool checkAndClearRanSinceLastCodeAgingCheck()
+        {
+            bool result = m_ranSinceLastCodeAgingCheck;
+            m_ranSinceLastCodeAgingCheck = 0;
+            return result;
+        }
+        
         // Functions for controlling when tiered compilation kicks in. This
         // controls both when the optimizing compiler is invoked and when OSR
         // entry happens. Two triggers exist: the loop trigger and the return
@@ -1066,6 +1078,7 @@ namespace JSC {
         int m_numCalleeRegisters;
         int m_numVars;
         int m_numCapturedVars;
+        bool m_capturesArguments;
         bool m_isConstructor;
 
     protected:
@@ -1241,6 +1254,7 @@ namespace JSC {
         uint32_t m_forcedOSRExitCounter;
         uint16_t m_optimizationDelayCounter;
         uint16_t m_reoptimizationRetryCounter;
+        uint32_t m_ranSinceLastCodeAgingCheck;
         
         struct RareData {
            WTF_MAKE_FAST_ALLOCATED;
@@ -439,6 +439,12 @@ BytecodeGenerator::BytecodeGenerator(FunctionBodyNode* functionBody, ScopeChainN
     for (size_t i = 0; i < parameters.size(); ++i)
         addParameter(parameters[i], nextParameterIndex--);
 
+    // The activation only needs its own copy of the actual arguments if
+    // something can reach them through it after the frame is gone.
+    codeBlock->m_capturesArguments = functionBody->usesArguments() || functionBody->needsActivationForMoreThanVariables() || m_shouldEmitDebugHooks;
+    for (size_t i = 0; i < parameters.size() && !codeBlock->m_capturesArguments; ++i)
+        codeBlock->m_capturesArguments = functionBody->captures(parameters[i]);
+
     preserveLastVar();
 
     if (isConstructor()) {
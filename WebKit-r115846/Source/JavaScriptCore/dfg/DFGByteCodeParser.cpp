@@ -2320,11 +2320,24 @@ bool ByteCodeParser::parseBlock(unsigned limit)
         case op_resolve_global: {
             PredictedType prediction = getPrediction();
             
+            unsigned identifierNumber = m_inlineStackTop->m_identifierRemap[currentInstruction[2].u.operand];
+            unsigned resolveInfoIndex = m_globalResolveNumber++;
+            
+            // A global var or function declared after this code was generated now has a
+            // fixed slot in the global object's register storage, and global declarations
+            // can't be deleted, so read the slot directly rather than through the resolve
+            // cache's Structure check.
+            SymbolTableEntry entry = m_inlineStackTop->m_codeBlock->globalObject()->symbolTable().get(m_codeBlock->identifier(identifierNumber).impl());
+            if (!entry.isNull()) {
+                set(currentInstruction[1].u.operand, addToGraph(GetGlobalVar, OpInfo(entry.getIndex()), OpInfo(prediction)));
+                NEXT_OPCODE(op_resolve_global);
+            }
+            
             NodeIndex resolve = addToGraph(ResolveGlobal, OpInfo(m_graph.m_resolveGlobalData.size()), OpInfo(prediction));
             m_graph.m_resolveGlobalData.append(ResolveGlobalData());
             ResolveGlobalData& data = m_graph.m_resolveGlobalData.last();
-            data.identifierNumber = m_inlineStackTop->m_identifierRemap[currentInstruction[2].u.operand];
-            data.resolveInfoIndex = m_globalResolveNumber++;
+            data.identifierNumber = identifierNumber;
+            data.resolveInfoIndex = resolveInfoIndex;
             set(currentInstruction[1].u.operand, resolve);
 
             NEXT_OPCODE(op_resolve_global);
@@ -62,6 +62,7 @@ void JITCompiler::compileEntry()
     preserveReturnAddressAfterCall(GPRInfo::regT2);
     emitPutToCallFrameHeader(GPRInfo::regT2, RegisterFile::ReturnPC);
     emitPutImmediateToCallFrameHeader(m_codeBlock, RegisterFile::CodeBlock);
+    store32(TrustedImm32(1), m_codeBlock->addressOfRanSinceLastCodeAgingCheck());
 }
 
 void JITCompiler::compileBody(SpeculativeJIT& speculative)
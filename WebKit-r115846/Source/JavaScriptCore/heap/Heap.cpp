@@ -710,6 +710,42 @@ void Heap::discardAllCompiledCode()
         current->discardCode();
 }
 
+void Heap::discardColdCompiledCode()
+{
+    // If JavaScript is running, it's not safe to recompile, since we'll end
+    // up throwing away code that is live on the stack.
+    if (m_globalData->dynamicGlobalObject)
+        return;
+
+    HashSet<FunctionExecutable*> liveFunctions;
+    Vector<FunctionExecutable*> worklist;
+    for (FunctionExecutable* current = m_functions.head(); current; current = current->next()) {
+        if (current->ranSinceLastCodeAgingCheck()) {
+            liveFunctions.add(current);
+            worklist.append(current);
+        }
+    }
+
+    // OSR exit from optimized code needs the baseline code of every function
+    // it inlined, so those have to be kept along with it.
+    Vector<FunctionExecutable*> inlinedFunctions;
+    while (!worklist.isEmpty()) {
+        FunctionExecutable* executable = worklist.last();
+        worklist.removeLast();
+        executable->appendInlinedFunctions(inlinedFunctions);
+        for (size_t i = 0; i < inlinedFunctions.size(); ++i) {
+            if (liveFunctions.add(inlinedFunctions[i]).isNewEntry)
+                worklist.append(inlinedFunctions[i]);
+        }
+        inlinedFunctions.clear();
+    }
+
+    for (FunctionExecutable* current = m_functions.head(); current; current = current->next()) {
+        if (!liveFunctions.contains(current))
+            current->discardCode();
+    }
+}
+
 void Heap::collectAllGarbage()
 {
     if (!m_isSafeToCollect)
@@ -733,7 +769,7 @@ void Heap::collect(SweepToggle sweepToggle)
 
     double lastGCStartTime = WTF::currentTime();
     if (lastGCStartTime - m_lastCodeDiscardTime > minute) {
-        discardAllCompiledCode();
+        discardColdCompiledCode();
         m_lastCodeDiscardTime = WTF::currentTime();
     }
 
@@ -151,6 +151,7 @@ namespace JSC {
         double lastGCLength() { return m_lastGCLength; }
 
         JS_EXPORT_PRIVATE void discardAllCompiledCode();
+        void discardColdCompiledCode();
 
         void didAllocate(size_t);
 
@@ -4765,6 +4765,8 @@ skip_id_custom_self:
            This opcode appears only at the beginning of a code block.
         */
 
+        codeBlock->didRunSinceLastCodeAgingCheck();
+
         size_t i = 0;
         for (size_t count = codeBlock->m_numVars; i < count; ++i)
             callFrame->uncheckedR(i) = jsUndefined();
@@ -580,6 +580,7 @@ JITCode JIT::privateCompile(CodePtr* functionEntryArityCheck, JITCompilationEffo
     Label beginLabel(this);
 
     sampleCodeBlock(m_codeBlock);
+    store32(TrustedImm32(1), m_codeBlock->addressOfRanSinceLastCodeAgingCheck());
 #if ENABLE(OPCODE_SAMPLING)
     sampleInstruction(m_codeBlock->instructions().begin());
 #endif
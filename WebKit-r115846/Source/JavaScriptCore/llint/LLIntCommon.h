@@ -32,6 +32,10 @@
 // Print some information for some of the more subtle slow paths.
 #define LLINT_SLOW_PATH_TRACING 0
 
+// Count how often each opcode is executed and how often each slow path is
+// taken. The counts are dumped by JSGlobalData::dumpSampleData().
+#define LLINT_OPCODE_PROFILING 0
+
 // Disable inline allocation in the interpreter. This is great if you're changing
 // how the GC allocates.
 #define LLINT_ALWAYS_ALLOCATE_SLOW 0
@@ -79,6 +79,12 @@
 #define OFFLINE_ASM_EXECUTION_TRACING 0
 #endif
 
+#if LLINT_OPCODE_PROFILING
+#define OFFLINE_ASM_OPCODE_PROFILING 1
+#else
+#define OFFLINE_ASM_OPCODE_PROFILING 0
+#endif
+
 #if LLINT_ALWAYS_ALLOCATE_SLOW
 #define OFFLINE_ASM_ALWAYS_ALLOCATE_SLOW 1
 #else
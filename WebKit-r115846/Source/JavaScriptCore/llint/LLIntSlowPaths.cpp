@@ -49,7 +49,37 @@
 
 namespace JSC { namespace LLInt {
 
+#if LLINT_OPCODE_PROFILING
+static uint64_t opcodeExecutionCounts[numOpcodeIDs];
+
+struct SlowPathCounter {
+    SlowPathCounter(const char* name)
+        : name(name)
+        , count(0)
+        , next(first)
+    {
+        first = this;
+    }
+
+    const char* name;
+    uint64_t count;
+    SlowPathCounter* next;
+
+    static SlowPathCounter* first;
+};
+
+SlowPathCounter* SlowPathCounter::first;
+
+#define LLINT_COUNT_SLOW_PATH() do {                                \
+        static SlowPathCounter slowPathCounter(__FUNCTION__);       \
+        ++slowPathCounter.count;                                    \
+    } while (false)
+#else
+#define LLINT_COUNT_SLOW_PATH() do { } while (false)
+#endif
+
 #define LLINT_BEGIN_NO_SET_PC() \
+    LLINT_COUNT_SLOW_PATH();                            \
     JSGlobalData& globalData = exec->globalData();      \
     NativeCallFrameTracer tracer(&globalData, exec)
 
@@ -236,6 +266,14 @@ LLINT_SLOW_PATH_DECL(trace)
     LLINT_END_IMPL();
 }
 
+#if LLINT_OPCODE_PROFILING
+LLINT_SLOW_PATH_DECL(count_opcode)
+{
+    ++opcodeExecutionCounts[exec->globalData().interpreter->getOpcodeID(pc[0].u.opcode)];
+    LLINT_END_IMPL();
+}
+#endif
+
 LLINT_SLOW_PATH_DECL(special_trace)
 {
     dataLog("%p / %p: executing special case bc#%zu, op#%u, return PC is %p\n",
@@ -1540,6 +1578,48 @@ LLINT_SLOW_PATH_DECL(throw_from_native_call)
     LLINT_END();
 }
 
+#if LLINT_OPCODE_PROFILING
+typedef std::pair<uint64_t, const char*> ProfileEntry;
+
+static bool profileEntryGreaterThan(const ProfileEntry& a, const ProfileEntry& b)
+{
+    return a.first > b.first;
+}
+
+static void dumpProfileEntries(const char* title, Vector<ProfileEntry>& entries)
+{
+    std::sort(entries.begin(), entries.end(), profileEntryGreaterThan);
+    uint64_t total = 0;
+    for (size_t i = 0; i < entries.size(); ++i)
+        total += entries[i].first;
+
+    dataLog("%s: %llu total\n", title, static_cast<unsigned long long>(total));
+    for (size_t i = 0; i < entries.size(); ++i) {
+        dataLog("    %16llu %6.2f%%  %s\n",
+                static_cast<unsigned long long>(entries[i].first),
+                100.0 * entries[i].first / total,
+                entries[i].second);
+    }
+}
+
+void dumpOpcodeProfile()
+{
+    Vector<ProfileEntry> opcodes;
+    for (unsigned i = 0; i < numOpcodeIDs; ++i) {
+        if (opcodeExecutionCounts[i])
+            opcodes.append(ProfileEntry(opcodeExecutionCounts[i], opcodeNames[i]));
+    }
+    if (!opcodes.isEmpty())
+        dumpProfileEntries("LLInt opcode executions", opcodes);
+
+    Vector<ProfileEntry> slowPaths;
+    for (SlowPathCounter* counter = SlowPathCounter::first; counter; counter = counter->next)
+        slowPaths.append(ProfileEntry(counter->count, counter->name));
+    if (!slowPaths.isEmpty())
+        dumpProfileEntries("LLInt slow paths", slowPaths);
+}
+#endif // LLINT_OPCODE_PROFILING
+
 } } // namespace JSC::LLInt
 
 #endif // ENABLE(LLINT)
@@ -31,6 +31,8 @@
 
 #if ENABLE(LLINT)
 
+#include "LLIntCommon.h"
+
 namespace JSC {
 
 class ExecState;
@@ -85,6 +87,9 @@ LLINT_SLOW_PATH_DECL(trace_arityCheck_for_call);
 LLINT_SLOW_PATH_DECL(trace_arityCheck_for_construct);
 LLINT_SLOW_PATH_DECL(trace);
 LLINT_SLOW_PATH_DECL(special_trace);
+#if LLINT_OPCODE_PROFILING
+LLINT_SLOW_PATH_DECL(count_opcode);
+#endif
 LLINT_SLOW_PATH_DECL(entry_osr);
 LLINT_SLOW_PATH_DECL(entry_osr_function_for_call);
 LLINT_SLOW_PATH_DECL(entry_osr_function_for_construct);
@@ -191,6 +196,10 @@ LLINT_SLOW_PATH_DECL(slow_path_profile_will_call);
 LLINT_SLOW_PATH_DECL(slow_path_profile_did_call);
 LLINT_SLOW_PATH_DECL(throw_from_native_call);
 
+#if LLINT_OPCODE_PROFILING
+void dumpOpcodeProfile();
+#endif
+
 } } // namespace JSC::LLInt
 
 #endif // ENABLE(LLINT)
@@ -140,6 +140,9 @@ macro traceExecution()
     if EXECUTION_TRACING
         callSlowPath(_llint_trace)
     end
+    if OPCODE_PROFILING
+        callSlowPath(_llint_count_opcode)
+    end
 end
 
 macro slowPathForCall(advance, slowPath)
@@ -221,6 +224,7 @@ macro prologue(codeBlockGetter, codeBlockSetter, osrSlowPath, traceSlowPath)
     .continue:
     end
     codeBlockSetter(t1)
+    storei 1, CodeBlock::m_ranSinceLastCodeAgingCheck[t1]
     
     # Set up the PC.
     if JSVALUE64
@@ -66,8 +66,13 @@ void Arguments::copyToArguments(ExecState* exec, CallFrame* callFrame, uint32_t
         return;
     }
     ASSERT(length == this->length(exec));
+    if (LIKELY(!d->deletedArguments)) {
+        for (size_t i = 0; i < length; ++i)
+            callFrame->setArgument(i, argument(i).get());
+        return;
+    }
     for (size_t i = 0; i < length; ++i) {
-        if (!d->deletedArguments || !d->deletedArguments[i])
+        if (!d->deletedArguments[i])
             callFrame->setArgument(i, argument(i).get());
         else
             callFrame->setArgument(i, get(exec, i));
@@ -83,8 +88,13 @@ void Arguments::fillArgList(ExecState* exec, MarkedArgumentBuffer& args)
         return;
     }
     uint32_t length = this->length(exec);
+    if (LIKELY(!d->deletedArguments)) {
+        for (size_t i = 0; i < length; ++i)
+            args.append(argument(i).get());
+        return;
+    }
     for (size_t i = 0; i < length; ++i) {
-        if (!d->deletedArguments || !d->deletedArguments[i])
+        if (!d->deletedArguments[i])
             args.append(argument(i).get());
         else
             args.append(get(exec, i));
@@ -93,6 +93,12 @@ namespace JSC {
         {
             if (isTornOff())
                 return;
+            // The activation only keeps the actual arguments when the function
+            // needs them, so copy them out of the still-live frame otherwise.
+            if (static_cast<unsigned>(activation->capturedArgumentCount()) < d->numArguments) {
+                tearOff(CallFrame::create(reinterpret_cast<Register*>(d->registers)));
+                return;
+            }
             d->activation.set(globalData, this, activation);
             d->registers = &activation->registerAt(0);
         }
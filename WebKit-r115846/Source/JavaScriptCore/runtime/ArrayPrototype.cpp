@@ -147,6 +147,17 @@ static JSValue getProperty(ExecState* exec, JSObject* obj, unsigned index)
     return slot.getValue(exec, index);
 }
 
+// Returns true if every index in [begin, end) is held in the array's vector,
+// so the range can be read with getIndex() without consulting the prototype chain.
+static inline bool isDenseRange(JSArray* array, unsigned begin, unsigned end)
+{
+    for (unsigned k = begin; k < end; ++k) {
+        if (!array->canGetIndex(k))
+            return false;
+    }
+    return true;
+}
+
 static void putProperty(ExecState* exec, JSObject* obj, const Identifier& propertyName, JSValue value)
 {
     PutPropertySlot slot;
@@ -193,7 +204,17 @@ static inline void shift(ExecState* exec, JSObject* thisObj, unsigned header, un
     if (!header && isJSArray(thisObj) && asArray(thisObj)->shiftCount(exec, count))
         return;
 
-    for (unsigned k = header; k < length - currentCount; ++k) {
+    unsigned k = header;
+    if (isJSArray(thisObj)) {
+        JSArray* array = asArray(thisObj);
+        if (isDenseRange(array, header + currentCount, length)) {
+            JSGlobalData& globalData = exec->globalData();
+            for (; k < length - currentCount; ++k)
+                array->setIndex(globalData, k + resultCount, array->getIndex(k + currentCount));
+        }
+    }
+
+    for (; k < length - currentCount; ++k) {
         unsigned from = k + currentCount;
         unsigned to = k + resultCount;
         PropertySlot slot(thisObj);
@@ -209,7 +230,7 @@ static inline void shift(ExecState* exec, JSObject* thisObj, unsigned header, un
             return;
         }
     }
-    for (unsigned k = length; k > length - count; --k) {
+    for (k = length; k > length - count; --k) {
         if (!thisObj->methodTable()->deletePropertyByIndex(thisObj, exec, k - 1)) {
             throwTypeError(exec, "Unable to delete property.");
             return;
@@ -233,7 +254,17 @@ static inline void unshift(ExecState* exec, JSObject* thisObj, unsigned header,
     if (!header && isJSArray(thisObj) && asArray(thisObj)->unshiftCount(exec, count))
         return;
 
-    for (unsigned k = length - currentCount; k > header; --k) {
+    unsigned k = length - currentCount;
+    if (isJSArray(thisObj) && k > header) {
+        JSArray* array = asArray(thisObj);
+        if (array->canSetIndex(length - 1 + count) && isDenseRange(array, header + currentCount, length)) {
+            JSGlobalData& globalData = exec->globalData();
+            for (; k > header; --k)
+                array->setIndex(globalData, k + resultCount - 1, array->getIndex(k + currentCount - 1));
+        }
+    }
+
+    for (; k > header; --k) {
         unsigned from = k + currentCount - 1;
         unsigned to = k + resultCount - 1;
         PropertySlot slot(thisObj);
@@ -449,7 +480,16 @@ EncodedJSValue JSC_HOST_CALL arrayProtoFuncConcat(ExecState* exec)
         if (curArg.inherits(&JSArray::s_info)) {
             unsigned length = curArg.get(exec, exec->propertyNames().length).toUInt32(exec);
             JSObject* curObject = curArg.toObject(exec);
-            for (unsigned k = 0; k < length; ++k) {
+            unsigned k = 0;
+            if (isJSArray(curObject)) {
+                JSArray* curArray = asArray(curObject);
+                for (; k < length; ++k, ++n) {
+                    if (!curArray->canGetIndex(k))
+                        break;
+                    arr->putDirectIndex(exec, n, curArray->getIndex(k));
+                }
+            }
+            for (; k < length; ++k) {
                 JSValue v = getProperty(exec, curObject, k);
                 if (exec->hadException())
                     return JSValue::encode(jsUndefined());
@@ -598,13 +638,26 @@ EncodedJSValue JSC_HOST_CALL arrayProtoFuncSlice(ExecState* exec)
     if (exec->hadException())
         return JSValue::encode(jsUndefined());
 
+    unsigned begin = argumentClampedIndexFromStartOrEnd(exec, 0, length);
+    unsigned end = argumentClampedIndexFromStartOrEnd(exec, 1, length, length);
+
+    if (begin < end && isJSArray(thisObj) && isDenseRange(asArray(thisObj), begin, end)) {
+        JSArray* array = asArray(thisObj);
+        unsigned resultLength = end - begin;
+        JSArray* resObj = JSArray::tryCreateUninitialized(exec->globalData(), exec->lexicalGlobalObject()->arrayStructure(), resultLength);
+        if (!resObj)
+            return JSValue::encode(throwOutOfMemoryError(exec));
+        JSGlobalData& globalData = exec->globalData();
+        for (unsigned k = 0; k < resultLength; ++k)
+            resObj->initializeIndex(globalData, k, array->getIndex(k + begin));
+        resObj->completeInitialization(resultLength);
+        return JSValue::encode(resObj);
+    }
+
     // We return a new array
     JSArray* resObj = constructEmptyArray(exec);
     JSValue result = resObj;
 
-    unsigned begin = argumentClampedIndexFromStartOrEnd(exec, 0, length);
-    unsigned end = argumentClampedIndexFromStartOrEnd(exec, 1, length, length);
-
     unsigned n = 0;
     for (unsigned k = begin; k < end; k++, n++) {
         JSValue v = getProperty(exec, thisObj, k);
@@ -712,7 +765,16 @@ EncodedJSValue JSC_HOST_CALL arrayProtoFuncSplice(ExecState* exec)
 
     JSValue result = resObj;
     JSGlobalData& globalData = exec->globalData();
-    for (unsigned k = 0; k < deleteCount; k++) {
+    unsigned k = 0;
+    if (isJSArray(thisObj)) {
+        JSArray* array = asArray(thisObj);
+        for (; k < deleteCount; k++) {
+            if (!array->canGetIndex(k + begin))
+                break;
+            resObj->initializeIndex(globalData, k, array->getIndex(k + begin));
+        }
+    }
+    for (; k < deleteCount; k++) {
         JSValue v = getProperty(exec, thisObj, k + begin);
         if (exec->hadException())
             return JSValue::encode(jsUndefined());
@@ -730,7 +792,7 @@ EncodedJSValue JSC_HOST_CALL arrayProtoFuncSplice(ExecState* exec)
         if (exec->hadException())
             return JSValue::encode(jsUndefined());
     }
-    for (unsigned k = 0; k < additionalArgs; ++k) {
+    for (k = 0; k < additionalArgs; ++k) {
         thisObj->methodTable()->putByIndex(thisObj, exec, k + begin, exec->argument(k + 2), true);
         if (exec->hadException())
             return JSValue::encode(jsUndefined());
@@ -1214,6 +1276,15 @@ EncodedJSValue JSC_HOST_CALL arrayProtoFuncIndexOf(ExecState* exec)
 
     unsigned index = argumentClampedIndexFromStartOrEnd(exec, 1, length);
     JSValue searchElement = exec->argument(0);
+    if (isJSArray(thisObj)) {
+        JSArray* array = asArray(thisObj);
+        for (; index < length; ++index) {
+            if (!array->canGetIndex(index))
+                break;
+            if (JSValue::strictEqual(exec, searchElement, array->getIndex(index)))
+                return JSValue::encode(jsNumber(index));
+        }
+    }
     for (; index < length; ++index) {
         JSValue e = getProperty(exec, thisObj, index);
         if (exec->hadException())
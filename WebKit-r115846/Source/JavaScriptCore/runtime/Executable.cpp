@@ -142,6 +142,7 @@ FunctionExecutable::FunctionExecutable(JSGlobalData& globalData, const Identifie
     : ScriptExecutable(globalData.functionExecutableStructure.get(), globalData, source, inStrictContext)
     , m_numCapturedVariables(0)
     , m_forceUsesArguments(forceUsesArguments)
+    , m_capturesArguments(true)
     , m_parameters(parameters)
     , m_name(name)
     , m_inferredName(inferredName.isNull() ? globalData.propertyNames->emptyIdentifier : inferredName)
@@ -155,6 +156,7 @@ FunctionExecutable::FunctionExecutable(ExecState* exec, const Identifier& name,
     : ScriptExecutable(exec->globalData().functionExecutableStructure.get(), exec, source, inStrictContext)
     , m_numCapturedVariables(0)
     , m_forceUsesArguments(forceUsesArguments)
+    , m_capturesArguments(true)
     , m_parameters(parameters)
     , m_name(name)
     , m_inferredName(inferredName.isNull() ? exec->globalData().propertyNames->emptyIdentifier : inferredName)
@@ -548,6 +550,7 @@ JSObject* FunctionExecutable::compileForCallInternal(ExecState* exec, ScopeChain
     m_numParametersForCall = m_codeBlockForCall->numParameters();
     ASSERT(m_numParametersForCall);
     m_numCapturedVariables = m_codeBlockForCall->m_numCapturedVars;
+    m_capturesArguments = m_codeBlockForCall->m_capturesArguments;
     m_symbolTable = m_codeBlockForCall->sharedSymbolTable();
 
 #if ENABLE(JIT)
@@ -590,6 +593,7 @@ JSObject* FunctionExecutable::compileForConstructInternal(ExecState* exec, Scope
     m_numParametersForConstruct = m_codeBlockForConstruct->numParameters();
     ASSERT(m_numParametersForConstruct);
     m_numCapturedVariables = m_codeBlockForConstruct->m_numCapturedVars;
+    m_capturesArguments = m_codeBlockForConstruct->m_capturesArguments;
     m_symbolTable = m_codeBlockForConstruct->sharedSymbolTable();
 
 #if ENABLE(JIT)
@@ -656,6 +660,44 @@ void FunctionExecutable::discardCode()
     clearCode();
 }
 
+static bool checkAndClearRanSinceLastCodeAgingCheck(CodeBlock* codeBlock)
+{
+    // Optimized code may have exited to its baseline alternative, which then
+    // ran without entering the optimized code block.
+    bool result = false;
+    for (; codeBlock; codeBlock = codeBlock->alternative())
+        result |= codeBlock->checkAndClearRanSinceLastCodeAgingCheck();
+    return result;
+}
+
+bool FunctionExecutable::ranSinceLastCodeAgingCheck()
+{
+    bool ranForCall = checkAndClearRanSinceLastCodeAgingCheck(m_codeBlockForCall.get());
+    bool ranForConstruct = checkAndClearRanSinceLastCodeAgingCheck(m_codeBlockForConstruct.get());
+    return ranForCall || ranForConstruct;
+}
+
+#if ENABLE(DFG_JIT)
+static void appendInlinedFunctionsOf(CodeBlock* codeBlock, Vector<FunctionExecutable*>& result)
+{
+    if (!codeBlock || !JITCode::isOptimizingJIT(codeBlock->getJITType()))
+        return;
+    SegmentedVector<InlineCallFrame, 4>& inlineCallFrames = codeBlock->inlineCallFrames();
+    for (size_t i = 0; i < inlineCallFrames.size(); ++i)
+        result.append(static_cast<FunctionExecutable*>(inlineCallFrames[i].executable.get()));
+}
+#endif
+
+void FunctionExecutable::appendInlinedFunctions(Vector<FunctionExecutable*>& result)
+{
+#if ENABLE(DFG_JIT)
+    appendInlinedFunctionsOf(m_codeBlockForCall.get(), result);
+    appendInlinedFunctionsOf(m_codeBlockForConstruct.get(), result);
+#else
+    UNUSED_PARAM(result);
+#endif
+}
+
 void FunctionExecutable::finalize(JSCell* cell)
 {
     FunctionExecutable* executable = jsCast<FunctionExecutable*>(cell);
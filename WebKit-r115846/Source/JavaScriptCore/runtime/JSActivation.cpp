@@ -43,7 +43,7 @@ const ClassInfo JSActivation::s_info = { "JSActivation", &Base::s_info, 0, 0, CR
 
 JSActivation::JSActivation(CallFrame* callFrame, FunctionExecutable* functionExecutable)
     : Base(callFrame->globalData(), callFrame->globalData().activationStructure.get(), functionExecutable->symbolTable(), callFrame->registers())
-    , m_numCapturedArgs(max(callFrame->argumentCount(), functionExecutable->parameterCount()))
+    , m_numCapturedArgs(functionExecutable->capturesArguments() ? max(callFrame->argumentCount(), functionExecutable->parameterCount()) : 0)
     , m_numCapturedVars(functionExecutable->capturedVariableCount())
     , m_isTornOff(false)
     , m_requiresDynamicChecks(functionExecutable->usesEval() && !functionExecutable->isStrictMode())
@@ -90,12 +90,22 @@ void JSActivation::visitChildren(JSCell* cell, SlotVisitor& visitor)
     visitor.appendValues(registerArray + offset, thisObject->m_numCapturedVars);
 }
 
+inline bool JSActivation::isCapturedIndex(int index) const
+{
+    if (index >= m_numCapturedVars)
+        return false;
+    if (index >= 0)
+        return true;
+    // Parameters sit below the call frame header.
+    return CallFrame::argumentOffset(0) - index < m_numCapturedArgs;
+}
+
 inline bool JSActivation::symbolTableGet(const Identifier& propertyName, PropertySlot& slot)
 {
     SymbolTableEntry entry = symbolTable().inlineGet(propertyName.impl());
     if (entry.isNull())
         return false;
-    if (m_isTornOff && entry.getIndex() >= m_numCapturedVars)
+    if (m_isTornOff && !isCapturedIndex(entry.getIndex()))
         return false;
 
     slot.setValue(registerAt(entry.getIndex()).get());
@@ -115,7 +125,7 @@ inline bool JSActivation::symbolTablePut(ExecState* exec, const Identifier& prop
             throwTypeError(exec, StrictModeReadonlyPropertyWriteError);
         return true;
     }
-    if (m_isTornOff && entry.getIndex() >= m_numCapturedVars)
+    if (m_isTornOff && !isCapturedIndex(entry.getIndex()))
         return false;
 
     registerAt(entry.getIndex()).set(globalData, this, value);
@@ -129,7 +139,7 @@ void JSActivation::getOwnPropertyNames(JSObject* object, ExecState* exec, Proper
     for (SymbolTable::const_iterator it = thisObject->symbolTable().begin(); it != end; ++it) {
         if (it->second.getAttributes() & DontEnum && mode != IncludeDontEnumProperties)
             continue;
-        if (it->second.getIndex() >= thisObject->m_numCapturedVars)
+        if (!thisObject->isCapturedIndex(it->second.getIndex()))
             continue;
         propertyNames.add(Identifier(exec, it->first.get()));
     }
@@ -146,7 +156,7 @@ inline bool JSActivation::symbolTablePutWithAttributes(JSGlobalData& globalData,
         return false;
     SymbolTableEntry& entry = iter->second;
     ASSERT(!entry.isNull());
-    if (entry.getIndex() >= m_numCapturedVars)
+    if (!isCapturedIndex(entry.getIndex()))
         return false;
 
     entry.setAttributes(attributes);
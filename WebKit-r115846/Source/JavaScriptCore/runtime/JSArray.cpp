@@ -979,9 +979,20 @@ void JSArray::getOwnPropertyNames(JSObject* object, ExecState* exec, PropertyNam
     ArrayStorage* storage = thisObject->m_storage;
     
     unsigned usedVectorLength = min(storage->m_length, thisObject->m_vectorLength);
-    for (unsigned i = 0; i < usedVectorLength; ++i) {
-        if (storage->m_vector[i])
-            propertyNames.add(Identifier::from(exec, i));
+    // Indices are distinct from each other, so when they are the first names collected (the
+    // common for-in case) they can skip PropertyNameArray's duplicate check, which otherwise
+    // hashes every index into a set once the array has more than a handful of elements.
+    if (!propertyNames.size()) {
+        propertyNames.data()->propertyNameVector().reserveCapacity(storage->m_numValuesInVector);
+        for (unsigned i = 0; i < usedVectorLength; ++i) {
+            if (storage->m_vector[i])
+                propertyNames.addKnownUnique(Identifier::from(exec, i).impl());
+        }
+    } else {
+        for (unsigned i = 0; i < usedVectorLength; ++i) {
+            if (storage->m_vector[i])
+                propertyNames.add(Identifier::from(exec, i));
+        }
     }
 
     if (SparseArrayValueMap* map = thisObject->m_sparseValueMap) {
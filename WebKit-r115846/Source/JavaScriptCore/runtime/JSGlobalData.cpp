@@ -46,6 +46,8 @@
 #include "JSNotAnObject.h"
 #include "JSPropertyNameIterator.h"
 #include "JSStaticScopeObject.h"
+#include "LLIntCommon.h"
+#include "LLIntSlowPaths.h"
 #include "Lexer.h"
 #include "Lookup.h"
 #include "Nodes.h"
@@ -396,6 +398,9 @@ void JSGlobalData::dumpSampleData(ExecState* exec)
 #if ENABLE(ASSEMBLER)
     ExecutableAllocator::dumpProfile();
 #endif
+#if ENABLE(LLINT) && LLINT_OPCODE_PROFILING
+    LLInt::dumpOpcodeProfile();
+#endif
 }
 
 struct StackPreservingRecompiler : public MarkedBlock::VoidFunctor {
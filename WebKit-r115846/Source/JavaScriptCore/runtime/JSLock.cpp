@@ -43,9 +43,13 @@ static pthread_mutex_t JSMutex = PTHREAD_MUTEX_INITIALIZER;
 // Thread-specific key that tells whether a thread holds the JSMutex, and how many times it was taken recursively.
 pthread_key_t JSLockCount;
 
+// Thread-specific key holding the DropAllLocks nesting depth for contexts that do not take the JSMutex.
+static pthread_key_t JSLockDropDepth;
+
 static void createJSLockCount()
 {
     pthread_key_create(&JSLockCount, 0);
+    pthread_key_create(&JSLockDropDepth, 0);
 }
 
 pthread_once_t createJSLockCountOnce = PTHREAD_ONCE_INIT;
@@ -167,15 +171,42 @@ bool JSLock::currentThreadIsHoldingLock()
 // need ensure that callbacks return in the reverse chronological order of the
 // order in which they were made - though implementing the less restrictive policy
 // would likely increase complexity and overhead.
+// Only the shared instance is guarded by the JSMutex, so only it needs this
+// process-wide policy. Other contexts never take the mutex and may run on
+// several threads at once, so they track their depth per thread. A shared
+// counter would be updated without synchronization, and a callback on one
+// thread would stop DropAllLocks from releasing locks on another.
 //
 static unsigned lockDropDepth = 0;
 
+static intptr_t incrementLockDropDepth(JSLockBehavior lockBehavior)
+{
+    if (lockBehavior == LockForReal)
+        return lockDropDepth++;
+
+    intptr_t depth = reinterpret_cast<intptr_t>(pthread_getspecific(JSLockDropDepth));
+    pthread_setspecific(JSLockDropDepth, reinterpret_cast<void*>(depth + 1));
+    return depth;
+}
+
+static void decrementLockDropDepth(JSLockBehavior lockBehavior)
+{
+    if (lockBehavior == LockForReal) {
+        --lockDropDepth;
+        return;
+    }
+
+    intptr_t depth = reinterpret_cast<intptr_t>(pthread_getspecific(JSLockDropDepth));
+    ASSERT(depth > 0);
+    pthread_setspecific(JSLockDropDepth, reinterpret_cast<void*>(depth - 1));
+}
+
 JSLock::DropAllLocks::DropAllLocks(ExecState* exec)
     : m_lockBehavior(exec->globalData().isSharedInstance() ? LockForReal : SilenceAssertionsOnly)
 {
     pthread_once(&createJSLockCountOnce, createJSLockCount);
 
-    if (lockDropDepth++) {
+    if (incrementLockDropDepth(m_lockBehavior)) {
         m_lockCount = 0;
         return;
     }
@@ -190,7 +221,7 @@ JSLock::DropAllLocks::DropAllLocks(JSLockBehavior JSLockBehavior)
 {
     pthread_once(&createJSLockCountOnce, createJSLockCount);
 
-    if (lockDropDepth++) {
+    if (incrementLockDropDepth(m_lockBehavior)) {
         m_lockCount = 0;
         return;
     }
@@ -208,7 +239,7 @@ JSLock::DropAllLocks::~DropAllLocks()
     for (intptr_t i = 0; i < m_lockCount; i++)
         JSLock::lock(m_lockBehavior);
 
-    --lockDropDepth;
+    decrementLockDropDepth(m_lockBehavior);
 }
 
 #else // (OS(DARWIN) || USE(PTHREADS))
@@ -92,7 +92,7 @@ RegExpConstructor::RegExpConstructor(JSGlobalObject* globalObject, Structure* st
 
 void RegExpConstructor::finishCreation(ExecState* exec, RegExpPrototype* regExpPrototype)
 {
-    Base::finishCreation(exec->globalData(), Identifier(exec, "RegExp"));
+    Base::finishCreation(exec->globalData(), exec->propertyNames().RegExp);
     ASSERT(inherits(&s_info));
 
     // ECMA 15.10.5.1 RegExp.prototype
@@ -70,11 +70,17 @@ namespace WebCore {
 
 const double TCPMaximumSegmentLifetime = 2 * 60.0;
 
+// Receive buffer storage up to this size is kept around while the buffer is drained, so that
+// steady streaming does not reallocate for every chunk received from the socket.
+const size_t maximumRetainedBufferCapacity = 64 * 1024;
+
 WebSocketChannel::WebSocketChannel(Document* document, WebSocketChannelClient* client)
     : m_document(document)
     , m_client(client)
     , m_buffer(0)
     , m_bufferSize(0)
+    , m_bufferStorage(0)
+    , m_bufferCapacity(0)
     , m_resumeTimer(this, &WebSocketChannel::resumeTimerFired)
     , m_suspended(false)
     , m_closing(false)
@@ -101,7 +107,7 @@ WebSocketChannel::WebSocketChannel(Document* document, WebSocketChannelClient* c
 
 WebSocketChannel::~WebSocketChannel()
 {
-    fastFree(m_buffer);
+    fastFree(m_bufferStorage);
 }
 
 bool WebSocketChannel::useHixie76Protocol()
@@ -222,7 +228,7 @@ void WebSocketChannel::fail(const String& reason)
         // FIXME: Should we do this in hixie-76 too?
         m_shouldDiscardReceivedData = true;
         if (m_buffer)
-            skipBuffer(m_bufferSize); // Save memory.
+            skipBuffer(m_bufferSize); // Drop the pending data; skipBuffer() frees the storage if it is over maximumRetainedBufferCapacity.
         m_deflateFramer.didFail();
         m_hasContinuousFrame = false;
         m_continuousFrameData.clear();
@@ -411,15 +417,30 @@ bool WebSocketChannel::appendToBuffer(const char* data, size_t len)
         LOG(Network, "WebSocket buffer overflow (%lu+%lu)", static_cast<unsigned long>(m_bufferSize), static_cast<unsigned long>(len));
         return false;
     }
-    char* newBuffer = 0;
-    if (!tryFastMalloc(newBufferSize).getValue(newBuffer))
-        return false;
 
-    if (m_buffer)
-        memcpy(newBuffer, m_buffer, m_bufferSize);
-    memcpy(newBuffer + m_bufferSize, data, len);
-    fastFree(m_buffer);
-    m_buffer = newBuffer;
+    if (!m_buffer)
+        m_buffer = m_bufferStorage;
+    size_t consumedSize = m_buffer - m_bufferStorage;
+    if (newBufferSize > m_bufferCapacity - consumedSize) {
+        if (newBufferSize <= m_bufferCapacity) {
+            // Reclaim the space of frames already consumed. This happens at most once per received
+            // chunk, instead of once per frame as skipBuffer() used to do.
+            memmove(m_bufferStorage, m_buffer, m_bufferSize);
+        } else {
+            size_t newCapacity = max(newBufferSize, min(m_bufferCapacity, numeric_limits<size_t>::max() / 2) * 2);
+            char* newStorage = 0;
+            if (!tryFastMalloc(newCapacity).getValue(newStorage))
+                return false;
+            if (m_bufferSize)
+                memcpy(newStorage, m_buffer, m_bufferSize);
+            fastFree(m_bufferStorage);
+            m_bufferStorage = newStorage;
+            m_bufferCapacity = newCapacity;
+        }
+        m_buffer = m_bufferStorage;
+    }
+
+    memcpy(m_buffer + m_bufferSize, data, len);
     m_bufferSize = newBufferSize;
     return true;
 }
@@ -429,11 +450,15 @@ void WebSocketChannel::skipBuffer(size_t len)
     ASSERT(len <= m_bufferSize);
     m_bufferSize -= len;
     if (!m_bufferSize) {
-        fastFree(m_buffer);
         m_buffer = 0;
+        if (m_bufferCapacity > maximumRetainedBufferCapacity) {
+            fastFree(m_bufferStorage);
+            m_bufferStorage = 0;
+            m_bufferCapacity = 0;
+        }
         return;
     }
-    memmove(m_buffer, m_buffer + len, m_bufferSize);
+    m_buffer += len;
 }
 
 bool WebSocketChannel::processBuffer()
@@ -756,7 +781,7 @@ bool WebSocketChannel::processFrameHixie76()
             errorFrame = true;
         }
         if (errorFrame) {
-            skipBuffer(m_bufferSize); // Save memory.
+            skipBuffer(m_bufferSize); // Drop the pending data; skipBuffer() frees the storage if it is over maximumRetainedBufferCapacity.
             m_shouldDiscardReceivedData = true;
             m_client->didReceiveMessageError();
             fail("WebSocket frame length too large");
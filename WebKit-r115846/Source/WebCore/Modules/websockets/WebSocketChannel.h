@@ -195,8 +195,13 @@ private:
     WebSocketChannelClient* m_client;
     OwnPtr<WebSocketHandshake> m_handshake;
     RefPtr<SocketStreamHandle> m_handle;
+    // Unprocessed received data, m_bufferSize bytes starting at m_buffer. m_buffer is null if there
+    // is no unprocessed data, otherwise it points into m_bufferStorage. Consumed frames are skipped
+    // by advancing m_buffer; the storage is compacted lazily when more data is appended.
     char* m_buffer;
     size_t m_bufferSize;
+    char* m_bufferStorage;
+    size_t m_bufferCapacity;
 
     Timer<WebSocketChannel> m_resumeTimer;
     bool m_suspended;
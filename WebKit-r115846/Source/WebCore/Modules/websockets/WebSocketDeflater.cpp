@@ -44,27 +44,49 @@
 
 namespace WebCore {
 
-static const int defaultMemLevel = 1;
 static const size_t bufferIncrementUnit = 4096;
+// Output buffers up to this size keep their capacity across messages, so that a connection exchanging
+// many small messages does not reallocate its buffers for each one. Larger buffers are released on reset.
+static const size_t maximumRetainedBufferCapacity = 64 * 1024;
 
-PassOwnPtr<WebSocketDeflater> WebSocketDeflater::create(int windowBits, ContextTakeOverMode contextTakeOverMode)
+// Grows the buffer so that at least bufferIncrementUnit bytes, and all of the capacity that is already
+// allocated, are available for zlib to write into. Returns the write position.
+static size_t growBufferForOutput(Vector<char>& buffer)
 {
-    return adoptPtr(new WebSocketDeflater(windowBits, contextTakeOverMode));
+    size_t writePosition = buffer.size();
+    buffer.grow(std::max(writePosition + bufferIncrementUnit, buffer.capacity()));
+    return writePosition;
 }
 
-WebSocketDeflater::WebSocketDeflater(int windowBits, ContextTakeOverMode contextTakeOverMode)
+static void resetBuffer(Vector<char>& buffer)
+{
+    if (buffer.capacity() > maximumRetainedBufferCapacity)
+        buffer.clear();
+    else
+        buffer.shrink(0);
+}
+
+PassOwnPtr<WebSocketDeflater> WebSocketDeflater::create(int windowBits, ContextTakeOverMode contextTakeOverMode, int memLevel)
+{
+    return adoptPtr(new WebSocketDeflater(windowBits, contextTakeOverMode, memLevel));
+}
+
+WebSocketDeflater::WebSocketDeflater(int windowBits, ContextTakeOverMode contextTakeOverMode, int memLevel)
     : m_windowBits(windowBits)
+    , m_memLevel(memLevel)
     , m_contextTakeOverMode(contextTakeOverMode)
 {
     ASSERT(m_windowBits >= 8);
     ASSERT(m_windowBits <= 15);
+    ASSERT(m_memLevel >= 1);
+    ASSERT(m_memLevel <= 9);
     m_stream = adoptPtr(new z_stream);
     memset(m_stream.get(), 0, sizeof(z_stream));
 }
 
 bool WebSocketDeflater::initialize()
 {
-    return deflateInit2(m_stream.get(), Z_DEFAULT_COMPRESSION, Z_DEFLATED, -m_windowBits, defaultMemLevel, Z_DEFAULT_STRATEGY) == Z_OK;
+    return deflateInit2(m_stream.get(), Z_DEFAULT_COMPRESSION, Z_DEFLATED, -m_windowBits, m_memLevel, Z_DEFAULT_STRATEGY) == Z_OK;
 }
 
 WebSocketDeflater::~WebSocketDeflater()
@@ -102,8 +124,7 @@ bool WebSocketDeflater::addBytes(const char* data, size_t length)
 bool WebSocketDeflater::finish()
 {
     while (true) {
-        size_t writePosition = m_buffer.size();
-        m_buffer.grow(writePosition + bufferIncrementUnit);
+        size_t writePosition = growBufferForOutput(m_buffer);
         size_t availableCapacity = m_buffer.size() - writePosition;
         setStreamParameter(m_stream.get(), 0, 0, m_buffer.data() + writePosition, availableCapacity);
         int result = deflate(m_stream.get(), Z_SYNC_FLUSH);
@@ -122,7 +143,7 @@ bool WebSocketDeflater::finish()
 
 void WebSocketDeflater::reset()
 {
-    m_buffer.clear();
+    resetBuffer(m_buffer);
     if (m_contextTakeOverMode == DoNotTakeOverContext)
         deflateReset(m_stream.get());
 }
@@ -158,8 +179,7 @@ bool WebSocketInflater::addBytes(const char* data, size_t length)
 
     size_t consumedSoFar = 0;
     while (consumedSoFar < length) {
-        size_t writePosition = m_buffer.size();
-        m_buffer.grow(writePosition + bufferIncrementUnit);
+        size_t writePosition = growBufferForOutput(m_buffer);
         size_t availableCapacity = m_buffer.size() - writePosition;
         size_t remainingLength = length - consumedSoFar;
         setStreamParameter(m_stream.get(), data + consumedSoFar, remainingLength, m_buffer.data() + writePosition, availableCapacity);
@@ -183,8 +203,7 @@ bool WebSocketInflater::finish()
     // Appends 4 octests of 0x00 0x00 0xff 0xff
     size_t consumedSoFar = 0;
     while (consumedSoFar < strippedLength) {
-        size_t writePosition = m_buffer.size();
-        m_buffer.grow(writePosition + bufferIncrementUnit);
+        size_t writePosition = growBufferForOutput(m_buffer);
         size_t availableCapacity = m_buffer.size() - writePosition;
         size_t remainingLength = strippedLength - consumedSoFar;
         setStreamParameter(m_stream.get(), strippedFields + consumedSoFar, remainingLength, m_buffer.data() + writePosition, availableCapacity);
@@ -203,7 +222,7 @@ bool WebSocketInflater::finish()
 
 void WebSocketInflater::reset()
 {
-    m_buffer.clear();
+    resetBuffer(m_buffer);
 }
 
 } // namespace WebCore
@@ -49,7 +49,10 @@ public:
         DoNotTakeOverContext,
         TakeOverContext
     };
-    static PassOwnPtr<WebSocketDeflater> create(int windowBits, ContextTakeOverMode = TakeOverContext);
+    // memLevel trades memory for compression ratio, as in zlib's deflateInit2(). Each deflater
+    // allocates about (1 << (windowBits + 2)) + (1 << (memLevel + 9)) bytes of zlib state.
+    static const int defaultMemLevel = 1;
+    static PassOwnPtr<WebSocketDeflater> create(int windowBits, ContextTakeOverMode = TakeOverContext, int memLevel = defaultMemLevel);
 
     ~WebSocketDeflater();
 
@@ -58,12 +61,14 @@ public:
     bool finish();
     const char* data() { return m_buffer.data(); }
     size_t size() const { return m_buffer.size(); }
+    size_t capacity() const { return m_buffer.capacity(); }
     void reset();
 
 private:
-    WebSocketDeflater(int windowBits, ContextTakeOverMode);
+    WebSocketDeflater(int windowBits, ContextTakeOverMode, int memLevel);
 
     int m_windowBits;
+    int m_memLevel;
     ContextTakeOverMode m_contextTakeOverMode;
     Vector<char> m_buffer;
     OwnPtr<z_stream> m_stream;
@@ -80,6 +85,7 @@ public:
     bool finish();
     const char* data() { return m_buffer.data(); }
     size_t size() const { return m_buffer.size(); }
+    size_t capacity() const { return m_buffer.capacity(); }
     void reset();
 
 private:
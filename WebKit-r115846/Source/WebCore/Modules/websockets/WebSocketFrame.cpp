@@ -27,7 +27,9 @@
 #include "WebSocketFrame.h"
 
 #include <wtf/CryptographicallyRandomNumber.h>
+#include <wtf/text/ASCIIFastPath.h>
 
+using namespace WTF;
 using namespace std;
 
 namespace WebCore {
@@ -45,6 +47,42 @@ const size_t payloadLengthWithTwoByteExtendedLengthField = 126;
 const size_t payloadLengthWithEightByteExtendedLengthField = 127;
 const size_t maskingKeyWidthInBytes = 4;
 
+// XORs the masking key over the payload. The bulk of the payload is processed one machine word at a time;
+// since the word size is a multiple of the key width, a single pre-rotated key word covers the whole
+// aligned body.
+static void maskPayload(char* payload, size_t payloadLength, const char* maskingKey)
+{
+    char* p = payload;
+    char* end = payload + payloadLength;
+    size_t keyIndex = 0;
+
+    // Prologue: align the payload.
+    while (p != end && !isAlignedToMachineWord(p)) {
+        *p++ ^= maskingKey[keyIndex];
+        keyIndex = (keyIndex + 1) % maskingKeyWidthInBytes;
+    }
+
+    if (static_cast<size_t>(end - p) >= sizeof(MachineWord)) {
+        char rotatedKey[sizeof(MachineWord)];
+        for (size_t i = 0; i < sizeof(MachineWord); ++i)
+            rotatedKey[i] = maskingKey[(keyIndex + i) % maskingKeyWidthInBytes];
+        MachineWord keyWord;
+        memcpy(&keyWord, rotatedKey, sizeof(MachineWord));
+
+        char* wordEnd = alignToMachineWord(end);
+        while (p != wordEnd) {
+            *reinterpret_cast<MachineWord*>(p) ^= keyWord;
+            p += sizeof(MachineWord);
+        }
+    }
+
+    // Epilogue: the key phase is unchanged after whole words.
+    while (p != end) {
+        *p++ ^= maskingKey[keyIndex];
+        keyIndex = (keyIndex + 1) % maskingKeyWidthInBytes;
+    }
+}
+
 bool WebSocketFrame::needsExtendedLengthField(size_t payloadLength)
 {
     return payloadLength > maxPayloadLengthWithoutExtendedLengthField;
@@ -113,8 +151,7 @@ WebSocketFrame::ParseFrameResult WebSocketFrame::parseFrame(char* data, size_t d
     if (masked) {
         const char* maskingKey = p;
         char* payload = p + maskingKeyWidthInBytes;
-        for (size_t i = 0; i < payloadLength; ++i)
-            payload[i] ^= maskingKey[i % maskingKeyWidthInBytes]; // Unmask the payload.
+        maskPayload(payload, payloadLength, maskingKey); // Unmask the payload.
     }
 
     frame.opCode = static_cast<WebSocketFrame::OpCode>(opCode);
@@ -142,8 +179,7 @@ static void appendFramePayload(const WebSocketFrame& frame, Vector<char>& frameD
 
     if (frame.masked) {
         cryptographicallyRandomValues(frameData.data() + maskingKeyStart, maskingKeyWidthInBytes);
-        for (size_t i = 0; i < frame.payloadLength; ++i)
-            frameData[payloadStart + i] ^= frameData[maskingKeyStart + i % maskingKeyWidthInBytes];
+        maskPayload(frameData.data() + payloadStart, frame.payloadLength, frameData.data() + maskingKeyStart);
     }
 }
 
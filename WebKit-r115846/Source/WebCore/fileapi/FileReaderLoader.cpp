@@ -61,6 +61,7 @@ FileReaderLoader::FileReaderLoader(ReadType readType, FileReaderLoaderClient* cl
     , m_stringResult("")
     , m_bytesLoaded(0)
     , m_totalBytes(0)
+    , m_decodedBytes(0)
     , m_errorCode(0)
 {
 }
@@ -183,6 +184,10 @@ void FileReaderLoader::didReceiveData(const char* data, int dataLength)
 
 void FileReaderLoader::didFinishLoading(unsigned long, double)
 {
+    // A result read from a progress event may have been converted as partial data, so the final
+    // result has to be converted again: readAsDataURL only produces it now, and readAsText has to
+    // flush the decoder.
+    m_isRawDataConverted = false;
     cleanup();
     if (m_client)
         m_client->didFinishLoading();
@@ -263,7 +268,10 @@ String FileReaderLoader::stringResult()
     default:
         ASSERT_NOT_REACHED();
     }
-    
+
+    // didReceiveData() and didFinishLoading() clear this again, so repeated reads of the result
+    // between progress events do not convert the same bytes over and over.
+    m_isRawDataConverted = true;
     return m_stringResult;
 }
 
@@ -275,12 +283,17 @@ void FileReaderLoader::convertToText()
     // Decode the data.
     // The File API spec says that we should use the supplied encoding if it is valid. However, we choose to ignore this
     // requirement in order to be consistent with how WebKit decodes the web content: always has the BOM override the
-    // provided encoding.     
-    // FIXME: consider supporting incremental decoding to improve the perf.
+    // provided encoding.
+    // Decoding is incremental: only the bytes received since the last conversion are fed to the decoder, which
+    // carries any incomplete multi-byte sequence over to the next call.
     StringBuilder builder;
     if (!m_decoder)
         m_decoder = TextResourceDecoder::create("text/plain", m_encoding.isValid() ? m_encoding : UTF8Encoding());
-    builder.append(m_decoder->decode(static_cast<const char*>(m_rawData->data()), m_bytesLoaded));
+    builder.append(m_stringResult);
+    if (m_decodedBytes < m_bytesLoaded) {
+        builder.append(m_decoder->decode(static_cast<const char*>(m_rawData->data()) + m_decodedBytes, m_bytesLoaded - m_decodedBytes));
+        m_decodedBytes = m_bytesLoaded;
+    }
 
     if (isCompleted())
         builder.append(m_decoder->flush());
@@ -306,8 +319,7 @@ void FileReaderLoader::convertToDataURL()
 
     Vector<char> out;
     base64Encode(static_cast<const char*>(m_rawData->data()), m_bytesLoaded, out);
-    out.append('\0');
-    builder.append(out.data());
+    builder.append(out.data(), out.size());
 
     m_stringResult = builder.toString();
 }
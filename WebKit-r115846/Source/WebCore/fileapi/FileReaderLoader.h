@@ -108,6 +108,10 @@ private:
 
     unsigned m_bytesLoaded;
     unsigned m_totalBytes;
+
+    // The number of bytes of m_rawData already fed to m_decoder.
+    unsigned m_decodedBytes;
+
     int m_errorCode;
 };
 
@@ -549,6 +549,12 @@ void HTMLCanvasElement::createImageBuffer() const
     m_imageBuffer->context()->setShadowsIgnoreTransforms(true);
     m_imageBuffer->context()->setImageInterpolationQuality(DefaultInterpolationQuality);
     m_imageBuffer->context()->setStrokeThickness(1);
+    // The 2D context skips setters whose value matches its current state, so
+    // the platform context has to start out with the canvas defaults. Some
+    // ports use different defaults (e.g. Skia's miter limit is 4, not 10).
+    m_imageBuffer->context()->setLineCap(ButtCap);
+    m_imageBuffer->context()->setLineJoin(MiterJoin);
+    m_imageBuffer->context()->setMiterLimit(10);
     m_contextStateSaver = adoptPtr(new GraphicsContextStateSaver(*m_imageBuffer->context()));
 
 #if USE(JSC)
@@ -371,6 +371,8 @@ void CanvasRenderingContext2D::setLineWidth(float width)
 {
     if (!(isfinite(width) && width > 0))
         return;
+    if (state().m_lineWidth == width)
+        return;
     state().m_lineWidth = width;
     GraphicsContext* c = drawingContext();
     if (!c)
@@ -388,6 +390,8 @@ void CanvasRenderingContext2D::setLineCap(const String& s)
     LineCap cap;
     if (!parseLineCap(s, cap))
         return;
+    if (state().m_lineCap == cap)
+        return;
     state().m_lineCap = cap;
     GraphicsContext* c = drawingContext();
     if (!c)
@@ -405,6 +409,8 @@ void CanvasRenderingContext2D::setLineJoin(const String& s)
     LineJoin join;
     if (!parseLineJoin(s, join))
         return;
+    if (state().m_lineJoin == join)
+        return;
     state().m_lineJoin = join;
     GraphicsContext* c = drawingContext();
     if (!c)
@@ -421,6 +427,8 @@ void CanvasRenderingContext2D::setMiterLimit(float limit)
 {
     if (!(isfinite(limit) && limit > 0))
         return;
+    if (state().m_miterLimit == limit)
+        return;
     state().m_miterLimit = limit;
     GraphicsContext* c = drawingContext();
     if (!c)
@@ -437,8 +445,7 @@ void CanvasRenderingContext2D::setShadowOffsetX(float x)
 {
     if (!isfinite(x))
         return;
-    state().m_shadowOffset.setWidth(x);
-    applyShadow();
+    setShadow(FloatSize(x, state().m_shadowOffset.height()), state().m_shadowBlur, state().m_shadowColor);
 }
 
 float CanvasRenderingContext2D::shadowOffsetY() const
@@ -450,8 +457,7 @@ void CanvasRenderingContext2D::setShadowOffsetY(float y)
 {
     if (!isfinite(y))
         return;
-    state().m_shadowOffset.setHeight(y);
-    applyShadow();
+    setShadow(FloatSize(state().m_shadowOffset.width(), y), state().m_shadowBlur, state().m_shadowColor);
 }
 
 float CanvasRenderingContext2D::shadowBlur() const
@@ -463,8 +469,7 @@ void CanvasRenderingContext2D::setShadowBlur(float blur)
 {
     if (!(isfinite(blur) && blur >= 0))
         return;
-    state().m_shadowBlur = blur;
-    applyShadow();
+    setShadow(state().m_shadowOffset, blur, state().m_shadowColor);
 }
 
 String CanvasRenderingContext2D::shadowColor() const
@@ -474,9 +479,10 @@ String CanvasRenderingContext2D::shadowColor() const
 
 void CanvasRenderingContext2D::setShadowColor(const String& color)
 {
-    if (!parseColorOrCurrentColor(state().m_shadowColor, color, canvas()))
+    RGBA32 rgba;
+    if (!parseColorOrCurrentColor(rgba, color, canvas()))
         return;
-    applyShadow();
+    setShadow(state().m_shadowOffset, state().m_shadowBlur, rgba);
 }
 
 const DashArray* CanvasRenderingContext2D::webkitLineDash() const
@@ -503,6 +509,8 @@ void CanvasRenderingContext2D::setWebkitLineDashOffset(float offset)
 {
     if (!isfinite(offset))
         return;
+    if (state().m_lineDashOffset == offset)
+        return;
 
     state().m_lineDashOffset = offset;
 
@@ -521,6 +529,8 @@ void CanvasRenderingContext2D::setGlobalAlpha(float alpha)
 {
     if (!(alpha >= 0 && alpha <= 1))
         return;
+    if (state().m_globalAlpha == alpha)
+        return;
     state().m_globalAlpha = alpha;
     GraphicsContext* c = drawingContext();
     if (!c)
@@ -538,6 +548,8 @@ void CanvasRenderingContext2D::setGlobalCompositeOperation(const String& operati
     CompositeOperator op;
     if (!parseCompositeOperator(operation, op))
         return;
+    if (state().m_globalComposite == op)
+        return;
     state().m_globalComposite = op;
     GraphicsContext* c = drawingContext();
     if (!c)
@@ -1079,72 +1091,57 @@ void CanvasRenderingContext2D::strokeRect(float x, float y, float width, float h
 
 void CanvasRenderingContext2D::setShadow(float width, float height, float blur)
 {
-    state().m_shadowOffset = FloatSize(width, height);
-    state().m_shadowBlur = blur;
-    state().m_shadowColor = Color::transparent;
-    applyShadow();
+    setShadow(FloatSize(width, height), blur, Color::transparent);
 }
 
 void CanvasRenderingContext2D::setShadow(float width, float height, float blur, const String& color)
 {
-    if (!parseColorOrCurrentColor(state().m_shadowColor, color, canvas()))
+    RGBA32 rgba;
+    if (!parseColorOrCurrentColor(rgba, color, canvas()))
         return;
-
-    state().m_shadowOffset = FloatSize(width, height);
-    state().m_shadowBlur = blur;
-    applyShadow();
+    setShadow(FloatSize(width, height), blur, rgba);
 }
 
 void CanvasRenderingContext2D::setShadow(float width, float height, float blur, float grayLevel)
 {
-    state().m_shadowOffset = FloatSize(width, height);
-    state().m_shadowBlur = blur;
-    state().m_shadowColor = makeRGBA32FromFloats(grayLevel, grayLevel, grayLevel, 1.0f);
-    applyShadow();
+    setShadow(FloatSize(width, height), blur, makeRGBA32FromFloats(grayLevel, grayLevel, grayLevel, 1.0f));
 }
 
 void CanvasRenderingContext2D::setShadow(float width, float height, float blur, const String& color, float alpha)
 {
     RGBA32 rgba;
-
     if (!parseColorOrCurrentColor(rgba, color, canvas()))
         return;
-
-    state().m_shadowColor = colorWithOverrideAlpha(rgba, alpha);
-    state().m_shadowOffset = FloatSize(width, height);
-    state().m_shadowBlur = blur;
-    applyShadow();
+    setShadow(FloatSize(width, height), blur, colorWithOverrideAlpha(rgba, alpha));
 }
 
 void CanvasRenderingContext2D::setShadow(float width, float height, float blur, float grayLevel, float alpha)
 {
-    state().m_shadowOffset = FloatSize(width, height);
-    state().m_shadowBlur = blur;
-    state().m_shadowColor = makeRGBA32FromFloats(grayLevel, grayLevel, grayLevel, alpha);
-    applyShadow();
+    setShadow(FloatSize(width, height), blur, makeRGBA32FromFloats(grayLevel, grayLevel, grayLevel, alpha));
 }
 
 void CanvasRenderingContext2D::setShadow(float width, float height, float blur, float r, float g, float b, float a)
 {
-    state().m_shadowOffset = FloatSize(width, height);
-    state().m_shadowBlur = blur;
-    state().m_shadowColor = makeRGBA32FromFloats(r, g, b, a);
-    applyShadow();
+    setShadow(FloatSize(width, height), blur, makeRGBA32FromFloats(r, g, b, a));
 }
 
 void CanvasRenderingContext2D::setShadow(float width, float height, float blur, float c, float m, float y, float k, float a)
 {
-    state().m_shadowOffset = FloatSize(width, height);
-    state().m_shadowBlur = blur;
-    state().m_shadowColor = makeRGBAFromCMYKA(c, m, y, k, a);
-    applyShadow();
+    setShadow(FloatSize(width, height), blur, makeRGBAFromCMYKA(c, m, y, k, a));
 }
 
 void CanvasRenderingContext2D::clearShadow()
 {
-    state().m_shadowOffset = FloatSize();
-    state().m_shadowBlur = 0;
-    state().m_shadowColor = Color::transparent;
+    setShadow(FloatSize(), 0, Color::transparent);
+}
+
+void CanvasRenderingContext2D::setShadow(const FloatSize& offset, float blur, RGBA32 color)
+{
+    if (state().m_shadowOffset == offset && state().m_shadowBlur == blur && state().m_shadowColor == color)
+        return;
+    state().m_shadowOffset = offset;
+    state().m_shadowBlur = blur;
+    state().m_shadowColor = color;
     applyShadow();
 }
 
@@ -282,6 +282,7 @@ private:
     State& state() { return m_stateStack.last(); }
     const State& state() const { return m_stateStack.last(); }
 
+    void setShadow(const FloatSize& offset, float blur, RGBA32 color);
     void applyShadow();
     bool shouldDrawShadows() const;
 
@@ -197,7 +197,10 @@ bool CanvasStyle::isEquivalentColor(const CanvasStyle& other) const
             && m_cmyka.k == other.m_cmyka.k
             && m_cmyka.a == other.m_cmyka.a;
     case Gradient:
+        // The same CanvasGradient applies the same shared Gradient, so re-applying it is a no-op.
+        return m_gradient == other.m_gradient;
     case ImagePattern:
+        return m_pattern == other.m_pattern;
     case CurrentColor:
     case CurrentColorWithOverrideAlpha:
         return false;
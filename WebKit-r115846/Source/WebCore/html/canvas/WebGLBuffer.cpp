@@ -36,6 +36,38 @@
 
 namespace WebCore {
 
+namespace {
+
+// Returns the maximum index of type T stored in the given byte range of the buffer, or -1 if the
+// range holds no complete index. The range is widened to cover every index it overlaps.
+template<typename T>
+int maxIndexInByteRange(const ArrayBuffer* buffer, GC3Dintptr byteOffset, GC3Dsizeiptr byteLength)
+{
+    GC3Dintptr numIndices = buffer->byteLength() / sizeof(T);
+    GC3Dintptr first = byteOffset / sizeof(T);
+    GC3Dintptr last = std::min<GC3Dintptr>((byteOffset + byteLength + sizeof(T) - 1) / sizeof(T), numIndices);
+    const T* p = static_cast<const T*>(buffer->data());
+    int maxIndex = -1;
+    for (GC3Dintptr i = first; i < last; ++i)
+        maxIndex = std::max(maxIndex, static_cast<int>(p[i]));
+    return maxIndex;
+}
+
+int maxIndexInByteRange(GC3Denum type, const ArrayBuffer* buffer, GC3Dintptr byteOffset, GC3Dsizeiptr byteLength)
+{
+    switch (type) {
+    case GraphicsContext3D::UNSIGNED_BYTE:
+        return maxIndexInByteRange<GC3Dubyte>(buffer, byteOffset, byteLength);
+    case GraphicsContext3D::UNSIGNED_SHORT:
+        return maxIndexInByteRange<GC3Dushort>(buffer, byteOffset, byteLength);
+    default:
+        ASSERT_NOT_REACHED();
+        return -1;
+    }
+}
+
+} // namespace anonymous
+
 PassRefPtr<WebGLBuffer> WebGLBuffer::create(WebGLRenderingContext* ctx)
 {
     return adoptRef(new WebGLBuffer(ctx));
@@ -141,13 +173,16 @@ bool WebGLBuffer::associateBufferSubDataImpl(GC3Dintptr offset, ArrayBuffer* arr
 
     switch (m_target) {
     case GraphicsContext3D::ELEMENT_ARRAY_BUFFER:
-        clearCachedMaxIndices();
         if (byteLength) {
             if (!m_elementArrayBuffer)
                 return false;
+            // Only the updated range is rescanned, so that small per-frame updates of
+            // large index buffers keep the cached max indices.
+            invalidateCachedMaxIndicesInRange(offset, byteLength);
             memcpy(static_cast<unsigned char*>(m_elementArrayBuffer->data()) + offset,
                    static_cast<unsigned char*>(array->data()) + arrayByteOffset,
                    byteLength);
+            updateCachedMaxIndicesInRange(offset, byteLength);
         }
         return true;
     case GraphicsContext3D::ARRAY_BUFFER:
@@ -211,6 +246,31 @@ void WebGLBuffer::clearCachedMaxIndices()
     memset(m_maxIndexCache, 0, sizeof(m_maxIndexCache));
 }
 
+void WebGLBuffer::invalidateCachedMaxIndicesInRange(GC3Dintptr byteOffset, GC3Dsizeiptr byteLength)
+{
+    ASSERT(m_elementArrayBuffer);
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(m_maxIndexCache); ++i) {
+        MaxIndexCacheEntry& entry = m_maxIndexCache[i];
+        if (!entry.type || entry.maxIndex < 0)
+            continue;
+        // If the range about to be overwritten may hold the maximum, the cached
+        // value can no longer be trusted once it is gone.
+        if (maxIndexInByteRange(entry.type, m_elementArrayBuffer.get(), byteOffset, byteLength) >= entry.maxIndex)
+            entry.maxIndex = -1;
+    }
+}
+
+void WebGLBuffer::updateCachedMaxIndicesInRange(GC3Dintptr byteOffset, GC3Dsizeiptr byteLength)
+{
+    ASSERT(m_elementArrayBuffer);
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(m_maxIndexCache); ++i) {
+        MaxIndexCacheEntry& entry = m_maxIndexCache[i];
+        if (!entry.type || entry.maxIndex < 0)
+            continue;
+        entry.maxIndex = std::max(entry.maxIndex, maxIndexInByteRange(entry.type, m_elementArrayBuffer.get(), byteOffset, byteLength));
+    }
+}
+
 }
 
 #endif // ENABLE(WEBGL)
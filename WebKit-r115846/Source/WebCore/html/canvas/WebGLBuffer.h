@@ -93,6 +93,12 @@ private:
 
     // Clears all of the cached max indices.
     void clearCachedMaxIndices();
+    // Called before and after the given byte range of the element array
+    // buffer is overwritten. The first invalidates the cached max indices
+    // which may be stored in the range; the second folds the new contents
+    // of the range into the cached max indices which are still valid.
+    void invalidateCachedMaxIndicesInRange(GC3Dintptr byteOffset, GC3Dsizeiptr byteLength);
+    void updateCachedMaxIndicesInRange(GC3Dintptr byteOffset, GC3Dsizeiptr byteLength);
 
     // Helper function called by the three associateBufferData().
     bool associateBufferDataImpl(ArrayBuffer* array, GC3Dintptr byteOffset, GC3Dsizeiptr byteLength);
@@ -98,8 +98,8 @@ void InspectorTimelineAgent::pushGCEventRecords()
     if (!m_gcEvents.size())
         return;
 
-    GCEvents events = m_gcEvents;
-    m_gcEvents.clear();
+    GCEvents events;
+    events.swap(m_gcEvents);
     for (GCEvents::iterator i = events.begin(); i != events.end(); ++i) {
         RefPtr<InspectorObject> record = TimelineRecordFactory::createGenericRecord(timestampFromMicroseconds(i->startTime), m_maxCallStackDepth);
         record->setObject("data", TimelineRecordFactory::createGCEventData(i->collectedBytes));
@@ -132,6 +132,7 @@ void InspectorTimelineAgent::clearFrontend()
 
 void InspectorTimelineAgent::restore()
 {
+    m_includeMemoryDetails = m_state->getBoolean(TimelineAgentState::includeMemoryDetails);
     if (m_state->getBoolean(TimelineAgentState::timelineAgentEnabled)) {
         m_maxCallStackDepth = m_state->getLong(TimelineAgentState::timelineMaxCallStackDepth);
         ErrorString error;
@@ -171,6 +172,7 @@ void InspectorTimelineAgent::stop(ErrorString*)
 void InspectorTimelineAgent::setIncludeMemoryDetails(ErrorString*, bool value)
 {
     m_state->setBoolean(TimelineAgentState::includeMemoryDetails, value);
+    m_includeMemoryDetails = value;
 }
 
 void InspectorTimelineAgent::didBeginFrame()
@@ -398,8 +400,7 @@ void InspectorTimelineAgent::innerAddRecordToTimeline(PassRefPtr<InspectorObject
         RefPtr<TypeBuilder::Timeline::TimelineEvent> recordChecked = TypeBuilder::Timeline::TimelineEvent::runtimeCast(record.release());
         m_frontend->eventRecorded(recordChecked.release());
     } else {
-        TimelineRecordEntry parent = m_recordStack.last();
-        parent.children->pushObject(record.release());
+        m_recordStack.last().children->pushObject(record.release());
     }
 }
 
@@ -412,7 +413,7 @@ void InspectorTimelineAgent::setHeapSizeStatistic(InspectorObject* record)
     record->setNumber("usedHeapSize", usedHeapSize);
     record->setNumber("totalHeapSize", totalHeapSize);
 
-    if (m_state->getBoolean(TimelineAgentState::includeMemoryDetails)) {
+    if (m_includeMemoryDetails) {
         RefPtr<InspectorObject> counters = InspectorObject::create();
         counters->setNumber("nodes", (m_inspectorType == PageInspector) ? InspectorCounters::counterValue(InspectorCounters::NodeCounter) : 0);
         counters->setNumber("documents", (m_inspectorType == PageInspector) ? InspectorCounters::counterValue(InspectorCounters::DocumentCounter) : 0);
@@ -427,13 +428,14 @@ void InspectorTimelineAgent::didCompleteCurrentRecord(const String& type)
     // an event.  Don't treat as an error.
     if (!m_recordStack.isEmpty()) {
         pushGCEventRecords();
-        TimelineRecordEntry entry = m_recordStack.last();
-        m_recordStack.removeLast();
+        TimelineRecordEntry& entry = m_recordStack.last();
         ASSERT(entry.type == type);
         entry.record->setObject("data", entry.data);
         entry.record->setArray("children", entry.children);
         entry.record->setNumber("endTime", timestamp());
-        addRecordToTimeline(entry.record, type);
+        RefPtr<InspectorObject> record = entry.record.release();
+        m_recordStack.removeLast();
+        addRecordToTimeline(record.release(), type);
     }
 }
 
@@ -443,6 +445,7 @@ InspectorTimelineAgent::InspectorTimelineAgent(InstrumentingAgents* instrumentin
     , m_timestampOffset(0)
     , m_id(1)
     , m_maxCallStackDepth(5)
+    , m_includeMemoryDetails(false)
     , m_inspectorType(type)
 {
 }
@@ -472,6 +475,10 @@ void InspectorTimelineAgent::pushCancelableRecord(PassRefPtr<InspectorObject> da
 
 void InspectorTimelineAgent::commitCancelableRecords()
 {
+    // This runs for every record, and there is almost never a cancelable record to commit.
+    if (m_recordStack.isEmpty() || !m_recordStack.last().cancelable)
+        return;
+
     Vector<TimelineRecordEntry> cancelableRecords;
     while (!m_recordStack.isEmpty()) {
         TimelineRecordEntry entry = m_recordStack.last();
@@ -182,6 +182,7 @@ private:
     typedef Vector<GCEvent> GCEvents;
     GCEvents m_gcEvents;
     int m_maxCallStackDepth;
+    bool m_includeMemoryDetails;
     InspectorType m_inspectorType;
 };
 
@@ -41,6 +41,10 @@
 #include <wtf/OwnArrayPtr.h>
 #include <wtf/PassOwnArrayPtr.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace WebCore {
 
 namespace {
@@ -55,6 +59,60 @@ uint8_t convertColor16BigTo8(uint16_t value)
     return static_cast<uint8_t>(value & 0x00FF);
 }
 
+#ifdef __SSE2__
+// The SSE2 routines below operate on four RGBA8 pixels held in the 32-bit
+// lanes of a vector. x86 is little-endian, so R is in the low byte of a lane.
+
+// Packs the low 16 bits of each 32-bit lane of the two vectors into a vector
+// of eight 16-bit values; lanes of |low| come first.
+__m128i packLow16BitsOfLanes(__m128i low, __m128i high)
+{
+    // _mm_packs_epi32 saturates signed values, so sign-extend the low 16 bits first.
+    low = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+    high = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+    return _mm_packs_epi32(low, high);
+}
+
+__m128i convertRGBA8ToUnsignedShort4444(__m128i pixels)
+{
+    __m128i r = _mm_and_si128(_mm_slli_epi32(pixels, 8), _mm_set1_epi32(0xF000));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, 4), _mm_set1_epi32(0x0F00));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0x00F0));
+    __m128i a = _mm_srli_epi32(pixels, 28);
+    return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+}
+
+__m128i convertRGBA8ToUnsignedShort5551(__m128i pixels)
+{
+    __m128i r = _mm_and_si128(_mm_slli_epi32(pixels, 8), _mm_set1_epi32(0xF800));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, 5), _mm_set1_epi32(0x07C0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 18), _mm_set1_epi32(0x003E));
+    __m128i a = _mm_srli_epi32(pixels, 31);
+    return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+}
+
+__m128i convertRGBA8ToUnsignedShort565(__m128i pixels)
+{
+    __m128i r = _mm_and_si128(_mm_slli_epi32(pixels, 8), _mm_set1_epi32(0xF800));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, 5), _mm_set1_epi32(0x07E0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 19), _mm_set1_epi32(0x001F));
+    return _mm_or_si128(_mm_or_si128(r, g), b);
+}
+
+// Premultiplies one pixel whose channels are held in the 32-bit lanes of
+// |pixel|. The arithmetic matches the scalar routines exactly: each color
+// channel is multiplied by alpha / 255.0f and truncated.
+__m128i premultiplyRGBA8Pixel(__m128i pixel)
+{
+    const __m128 colorMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    const __m128 alphaLaneOne = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+    __m128 channels = _mm_cvtepi32_ps(pixel);
+    __m128 scaleFactor = _mm_div_ps(_mm_shuffle_ps(channels, channels, _MM_SHUFFLE(3, 3, 3, 3)), _mm_set1_ps(255.0f));
+    scaleFactor = _mm_or_ps(_mm_and_ps(scaleFactor, colorMask), alphaLaneOne);
+    return _mm_cvttps_epi32(_mm_mul_ps(channels, scaleFactor));
+}
+#endif // __SSE2__
+
 } // anonymous namespace
 
 bool GraphicsContext3D::texImage2DResourceSafe(GC3Denum target, GC3Dint level, GC3Denum internalformat, GC3Dsizei width, GC3Dsizei height, GC3Dint border, GC3Denum format, GC3Denum type, GC3Dint unpackAlignment)
@@ -170,20 +228,8 @@ bool GraphicsContext3D::extractImageData(Image* image,
 {
     if (!image)
         return false;
-    if (!getImageData(image, format, type, premultiplyAlpha, ignoreGammaAndColorProfile, data))
+    if (!getImageData(image, format, type, flipY, premultiplyAlpha, ignoreGammaAndColorProfile, data))
         return false;
-    if (flipY) {
-        unsigned int componentsPerPixel, bytesPerComponent;
-        if (!computeFormatAndTypeParameters(format, type,
-                                            &componentsPerPixel,
-                                            &bytesPerComponent))
-            return false;
-        // The image data is tightly packed, and we upload it as such.
-        unsigned int unpackAlignment = 1;
-        flipVertically(data.data(), image->width(), image->height(),
-                       componentsPerPixel * bytesPerComponent,
-                       unpackAlignment);
-    }
     if (ImageObserver *observer = image->imageObserver())
         observer->didDraw(image);
     return true;
@@ -210,20 +256,9 @@ bool GraphicsContext3D::extractImageData(ImageData* imageData,
                     format,
                     type,
                     premultiplyAlpha ? AlphaDoPremultiply : AlphaDoNothing,
+                    flipY,
                     data.data()))
         return false;
-    if (flipY) {
-        unsigned int componentsPerPixel, bytesPerComponent;
-        if (!computeFormatAndTypeParameters(format, type,
-                                            &componentsPerPixel,
-                                            &bytesPerComponent))
-            return false;
-        // The image data is tightly packed, and we upload it as such.
-        unsigned int unpackAlignment = 1;
-        flipVertically(data.data(), width, height,
-                       componentsPerPixel * bytesPerComponent,
-                       unpackAlignment);
-    }
     return true;
 }
 
@@ -306,39 +341,13 @@ bool GraphicsContext3D::extractTextureData(unsigned int width, unsigned int heig
                     width, height, unpackAlignment,
                     format, type,
                     (premultiplyAlpha ? AlphaDoPremultiply : AlphaDoNothing),
+                    flipY,
                     data.data()))
         return false;
     // The pixel data is now tightly packed.
-    if (flipY)
-        flipVertically(data.data(), width, height, bytesPerPixel, 1);
     return true;
 }
 
-void GraphicsContext3D::flipVertically(void* imageData,
-                                       unsigned int width,
-                                       unsigned int height,
-                                       unsigned int bytesPerPixel,
-                                       unsigned int unpackAlignment)
-{
-    if (!width || !height)
-        return;
-    unsigned int validRowBytes = width * bytesPerPixel;
-    unsigned int totalRowBytes = validRowBytes;
-    unsigned int remainder = validRowBytes % unpackAlignment;
-    if (remainder)
-        totalRowBytes += (unpackAlignment - remainder);
-    uint8_t* tempRow = new uint8_t[validRowBytes];
-    uint8_t* data = static_cast<uint8_t*>(imageData);
-    for (unsigned i = 0; i < height / 2; i++) {
-        uint8_t* lowRow = data + (totalRowBytes * i);
-        uint8_t* highRow = data + (totalRowBytes * (height - i - 1));
-        memcpy(tempRow, lowRow, validRowBytes);
-        memcpy(lowRow, highRow, validRowBytes);
-        memcpy(highRow, tempRow, validRowBytes);
-    }
-    delete[] tempRow;
-}
-
 // The following packing and unpacking routines are expressed in terms
 // of line-by-line operations, and passed by function pointer rather
 // than template parameter, to achieve the majority of the speedups of
@@ -473,7 +482,18 @@ void unpackOneRowOfBGRA8ToRGBA8(const uint8_t* source, uint8_t* destination, uns
 {
     const uint32_t* source32 = reinterpret_cast_ptr<const uint32_t*>(source);
     uint32_t* destination32 = reinterpret_cast_ptr<uint32_t*>(destination);
-    for (unsigned int i = 0; i < pixelsPerRow; ++i) {
+    unsigned int i = 0;
+#ifdef __SSE2__
+    const __m128i brMask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i gaMask = _mm_set1_epi32(static_cast<int>(0xff00ff00));
+    for (; i + 4 <= pixelsPerRow; i += 4) {
+        __m128i bgra = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source32 + i));
+        __m128i swapped = _mm_or_si128(_mm_srli_epi32(bgra, 16), _mm_slli_epi32(bgra, 16));
+        __m128i rgba = _mm_or_si128(_mm_and_si128(swapped, brMask), _mm_and_si128(bgra, gaMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination32 + i), rgba);
+    }
+#endif
+    for (; i < pixelsPerRow; ++i) {
         uint32_t bgra = source32[i];
 #if CPU(BIG_ENDIAN)
         uint32_t brMask = 0xff00ff00;
@@ -876,7 +896,24 @@ void packOneRowOfRGBA8ToRGB8Unmultiply(const uint8_t* source, uint8_t* destinati
 
 void packOneRowOfRGBA8ToRGBA8Premultiply(const uint8_t* source, uint8_t* destination, unsigned int pixelsPerRow)
 {
-    for (unsigned int i = 0; i < pixelsPerRow; ++i) {
+    unsigned int i = 0;
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= pixelsPerRow; i += 4) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        __m128i low = _mm_unpacklo_epi8(pixels, zero);
+        __m128i high = _mm_unpackhi_epi8(pixels, zero);
+        __m128i pixel0 = premultiplyRGBA8Pixel(_mm_unpacklo_epi16(low, zero));
+        __m128i pixel1 = premultiplyRGBA8Pixel(_mm_unpackhi_epi16(low, zero));
+        __m128i pixel2 = premultiplyRGBA8Pixel(_mm_unpacklo_epi16(high, zero));
+        __m128i pixel3 = premultiplyRGBA8Pixel(_mm_unpackhi_epi16(high, zero));
+        __m128i result = _mm_packus_epi16(_mm_packs_epi32(pixel0, pixel1), _mm_packs_epi32(pixel2, pixel3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), result);
+        source += 16;
+        destination += 16;
+    }
+#endif
+    for (; i < pixelsPerRow; ++i) {
         float scaleFactor = source[3] / 255.0f;
         uint8_t sourceR = static_cast<uint8_t>(static_cast<float>(source[0]) * scaleFactor);
         uint8_t sourceG = static_cast<uint8_t>(static_cast<float>(source[1]) * scaleFactor);
@@ -909,7 +946,17 @@ void packOneRowOfRGBA8ToRGBA8Unmultiply(const uint8_t* source, uint8_t* destinat
 
 void packOneRowOfRGBA8ToUnsignedShort4444(const uint8_t* source, uint16_t* destination, unsigned int pixelsPerRow)
 {
-    for (unsigned int i = 0; i < pixelsPerRow; ++i) {
+    unsigned int i = 0;
+#ifdef __SSE2__
+    for (; i + 8 <= pixelsPerRow; i += 8) {
+        __m128i low = convertRGBA8ToUnsignedShort4444(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+        __m128i high = convertRGBA8ToUnsignedShort4444(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), packLow16BitsOfLanes(low, high));
+        source += 32;
+        destination += 8;
+    }
+#endif
+    for (; i < pixelsPerRow; ++i) {
         *destination = (((source[0] & 0xF0) << 8)
                         | ((source[1] & 0xF0) << 4)
                         | (source[2] & 0xF0)
@@ -954,7 +1001,17 @@ void packOneRowOfRGBA8ToUnsignedShort4444Unmultiply(const uint8_t* source, uint1
 
 void packOneRowOfRGBA8ToUnsignedShort5551(const uint8_t* source, uint16_t* destination, unsigned int pixelsPerRow)
 {
-    for (unsigned int i = 0; i < pixelsPerRow; ++i) {
+    unsigned int i = 0;
+#ifdef __SSE2__
+    for (; i + 8 <= pixelsPerRow; i += 8) {
+        __m128i low = convertRGBA8ToUnsignedShort5551(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+        __m128i high = convertRGBA8ToUnsignedShort5551(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), packLow16BitsOfLanes(low, high));
+        source += 32;
+        destination += 8;
+    }
+#endif
+    for (; i < pixelsPerRow; ++i) {
         *destination = (((source[0] & 0xF8) << 8)
                         | ((source[1] & 0xF8) << 3)
                         | ((source[2] & 0xF8) >> 2)
@@ -999,7 +1056,17 @@ void packOneRowOfRGBA8ToUnsignedShort5551Unmultiply(const uint8_t* source, uint1
 
 void packOneRowOfRGBA8ToUnsignedShort565(const uint8_t* source, uint16_t* destination, unsigned int pixelsPerRow)
 {
-    for (unsigned int i = 0; i < pixelsPerRow; ++i) {
+    unsigned int i = 0;
+#ifdef __SSE2__
+    for (; i + 8 <= pixelsPerRow; i += 8) {
+        __m128i low = convertRGBA8ToUnsignedShort565(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+        __m128i high = convertRGBA8ToUnsignedShort565(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), packLow16BitsOfLanes(low, high));
+        source += 32;
+        destination += 8;
+    }
+#endif
+    for (; i < pixelsPerRow; ++i) {
         *destination = (((source[0] & 0xF8) << 8)
                         | ((source[1] & 0xFC) << 3)
                         | ((source[2] & 0xF8) >> 3));
@@ -1127,6 +1194,19 @@ void packOneRowOfRGBA32FToRA32FPremultiply(const float* source, float* destinati
 
 } // anonymous namespace
 
+// Returns the destination row that source row |row| is packed into. If flipY
+// is true, the rows are written bottom-up, so that the packed data comes out
+// flipped without a separate pass over it.
+template<typename DestType>
+static DestType* destinationRow(DestType* destinationData,
+                                unsigned int row,
+                                unsigned int height,
+                                unsigned int destinationElementsPerRow,
+                                bool flipY)
+{
+    return destinationData + (flipY ? height - 1 - row : row) * destinationElementsPerRow;
+}
+
 // This is used whenever unpacking is necessary; i.e., the source data
 // is not in RGBA8/RGBA32F format, or the unpack alignment specifies
 // that rows are not tightly packed.
@@ -1138,26 +1218,19 @@ static void doUnpackingAndPacking(const SourceType* sourceData,
                                   unsigned int sourceElementsPerRow,
                                   DestType* destinationData,
                                   void (*rowPackingFunc)(const IntermediateType*, DestType*, unsigned int),
-                                  unsigned int destinationElementsPerPixel)
+                                  unsigned int destinationElementsPerPixel,
+                                  bool flipY)
 {
+    unsigned int destinationElementsPerRow = width * destinationElementsPerPixel;
     if (!rowPackingFunc) {
         // The row packing is trivial, so don't bother with a temporary buffer.
-        const SourceType* endPointer = sourceData + height * sourceElementsPerRow;
-        unsigned int destinationElementsPerRow = width * destinationElementsPerPixel;
-        while (sourceData < endPointer) {
-            rowUnpackingFunc(sourceData, reinterpret_cast<IntermediateType*>(destinationData), width);
-            sourceData += sourceElementsPerRow;
-            destinationData += destinationElementsPerRow;
-        }
+        for (unsigned int row = 0; row < height; ++row)
+            rowUnpackingFunc(sourceData + row * sourceElementsPerRow, reinterpret_cast<IntermediateType*>(destinationRow(destinationData, row, height, destinationElementsPerRow, flipY)), width);
     } else {
         OwnArrayPtr<IntermediateType> temporaryRGBAData = adoptArrayPtr(new IntermediateType[width * 4]);
-        const SourceType* endPointer = sourceData + height * sourceElementsPerRow;
-        unsigned int destinationElementsPerRow = width * destinationElementsPerPixel;
-        while (sourceData < endPointer) {
-            rowUnpackingFunc(sourceData, temporaryRGBAData.get(), width);
-            rowPackingFunc(temporaryRGBAData.get(), destinationData, width);
-            sourceData += sourceElementsPerRow;
-            destinationData += destinationElementsPerRow;
+        for (unsigned int row = 0; row < height; ++row) {
+            rowUnpackingFunc(sourceData + row * sourceElementsPerRow, temporaryRGBAData.get(), width);
+            rowPackingFunc(temporaryRGBAData.get(), destinationRow(destinationData, row, height, destinationElementsPerRow, flipY), width);
         }
     }
 }
@@ -1189,162 +1262,162 @@ static void doPacking(const void* sourceData,
                       unsigned int sourceUnpackAlignment,
                       DestType* destinationData,
                       void (*rowPackingFunc)(const uint8_t*, DestType*, unsigned int),
-                      unsigned int destinationElementsPerPixel)
+                      unsigned int destinationElementsPerPixel,
+                      bool flipY)
 {
     switch (sourceDataFormat) {
     case GraphicsContext3D::SourceFormatRGBA8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 4, sourceUnpackAlignment);
         const uint8_t* source = static_cast<const uint8_t*>(sourceData);
-        const uint8_t* endPointer = source + height * sourceElementsPerRow;
         unsigned int destinationElementsPerRow = width * destinationElementsPerPixel;
-        while (source < endPointer) {
+        for (unsigned int row = 0; row < height; ++row) {
+            const uint8_t* sourceRow = source + row * sourceElementsPerRow;
+            DestType* destination = destinationRow(destinationData, row, height, destinationElementsPerRow, flipY);
             if (rowPackingFunc)
-                rowPackingFunc(source, destinationData, width);
+                rowPackingFunc(sourceRow, destination, width);
             else
-                memcpy(destinationData, source, width * 4);
-            source += sourceElementsPerRow;
-            destinationData += destinationElementsPerRow;
+                memcpy(destination, sourceRow, width * 4);
         }
         break;
     }
     case GraphicsContext3D::SourceFormatRGBA16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 8, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRGBA16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 8, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRGB8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 3, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfRGB8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfRGB8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRGB16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 6, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGB16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGB16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRGB16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 6, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGB16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGB16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatBGR8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 3, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfBGR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfBGR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatARGB8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 4, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfARGB8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfARGB8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatARGB16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 8, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfARGB16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfARGB16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatARGB16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 8, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfARGB16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfARGB16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatABGR8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 4, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfABGR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfABGR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatBGRA8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 4, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfBGRA8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfBGRA8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatBGRA16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 8, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfBGRA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfBGRA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatBGRA16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 8, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfBGRA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfBGRA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRGBA5551: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA5551ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA5551ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRGBA4444: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA4444ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGBA4444ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRGB565: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGB565ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRGB565ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatR8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 1, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatR16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfR16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfR16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatR16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfR16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfR16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRA8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfRA8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfRA8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRA16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 4, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRA16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 4, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfRA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatAR8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfAR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfAR8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatAR16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 4, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfAR16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfAR16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatAR16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 4, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfAR16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfAR16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatA8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint8_t>(width, 1, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfA8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint8_t, uint8_t, DestType>(static_cast<const uint8_t*>(sourceData), unpackOneRowOfA8ToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatA16Little: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfA16LittleToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatA16Big: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<uint16_t>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<uint16_t, uint8_t, DestType>(static_cast<const uint16_t*>(sourceData), unpackOneRowOfA16BigToRGBA8, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     default:
@@ -1363,39 +1436,36 @@ static void doFloatingPointPacking(const void* sourceData,
                                    unsigned int sourceUnpackAlignment,
                                    float* destinationData,
                                    void rowPackingFunc(const float*, float*, unsigned int),
-                                   unsigned int destinationElementsPerPixel)
+                                   unsigned int destinationElementsPerPixel,
+                                   bool flipY)
 {
     switch (sourceDataFormat) {
     case GraphicsContext3D::SourceFormatRGBA8: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<float>(width, 4, sourceUnpackAlignment);
         const float* source = static_cast<const float*>(sourceData);
-        const float* endPointer = source + height * sourceElementsPerRow;
         unsigned int destinationElementsPerRow = width * destinationElementsPerPixel;
-        while (source < endPointer) {
-            rowPackingFunc(source, destinationData, width);
-            source += sourceElementsPerRow;
-            destinationData += destinationElementsPerRow;
-        }
+        for (unsigned int row = 0; row < height; ++row)
+            rowPackingFunc(source + row * sourceElementsPerRow, destinationRow(destinationData, row, height, destinationElementsPerRow, flipY), width);
         break;
     }
     case GraphicsContext3D::SourceFormatRGB32F: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<float>(width, 3, sourceUnpackAlignment);
-        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfRGB32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfRGB32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatR32F: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<float>(width, 1, sourceUnpackAlignment);
-        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfR32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfR32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatRA32F: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<float>(width, 2, sourceUnpackAlignment);
-        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfRA32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfRA32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     case GraphicsContext3D::SourceFormatA32F: {
         unsigned int sourceElementsPerRow = computeSourceElementsPerRow<float>(width, 1, sourceUnpackAlignment);
-        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfA32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel);
+        doUnpackingAndPacking<float, float, float>(static_cast<const float*>(sourceData), unpackOneRowOfA32FToRGBA32F, width, height, sourceElementsPerRow, destinationData, rowPackingFunc, destinationElementsPerPixel, flipY);
         break;
     }
     default:
@@ -1411,12 +1481,13 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
                                    unsigned int destinationFormat,
                                    unsigned int destinationType,
                                    AlphaOp alphaOp,
+                                   bool flipY,
                                    void* destinationData)
 {
     switch (destinationType) {
     case UNSIGNED_BYTE: {
         uint8_t* destination = static_cast<uint8_t*>(destinationData);
-        if (sourceDataFormat == SourceFormatRGBA8 && destinationFormat == RGBA && sourceUnpackAlignment <= 4 && alphaOp == AlphaDoNothing) {
+        if (sourceDataFormat == SourceFormatRGBA8 && destinationFormat == RGBA && sourceUnpackAlignment <= 4 && alphaOp == AlphaDoNothing && !flipY) {
             // No conversion necessary.
             memcpy(destinationData, sourceData, width * height * 4);
             break;
@@ -1425,27 +1496,27 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
         case RGB:
             switch (alphaOp) {
             case AlphaDoNothing:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGB8, 3);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGB8, 3, flipY);
                 break;
             case AlphaDoPremultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGB8Premultiply, 3);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGB8Premultiply, 3, flipY);
                 break;
             case AlphaDoUnmultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGB8Unmultiply, 3);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGB8Unmultiply, 3, flipY);
                 break;
             }
             break;
         case RGBA:
             switch (alphaOp) {
             case AlphaDoNothing:
-                ASSERT(sourceDataFormat != SourceFormatRGBA8 || sourceUnpackAlignment > 4); // Handled above with fast case.
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, 0, 4);
+                ASSERT(sourceDataFormat != SourceFormatRGBA8 || sourceUnpackAlignment > 4 || flipY); // Handled above with fast case.
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, 0, 4, flipY);
                 break;
             case AlphaDoPremultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGBA8Premultiply, 4);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGBA8Premultiply, 4, flipY);
                 break;
             case AlphaDoUnmultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGBA8Unmultiply, 4);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRGBA8Unmultiply, 4, flipY);
                 break;
             default:
                 ASSERT_NOT_REACHED();
@@ -1455,7 +1526,7 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
             // From the desktop OpenGL conversion rules (OpenGL 2.1
             // specification, Table 3.15), the alpha channel is chosen
             // from the RGBA data.
-            doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToA8, 1);
+            doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToA8, 1, flipY);
             break;
         case LUMINANCE:
             // From the desktop OpenGL conversion rules (OpenGL 2.1
@@ -1463,13 +1534,13 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
             // from the RGBA data.
             switch (alphaOp) {
             case AlphaDoNothing:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToR8, 1);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToR8, 1, flipY);
                 break;
             case AlphaDoPremultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToR8Premultiply, 1);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToR8Premultiply, 1, flipY);
                 break;
             case AlphaDoUnmultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToR8Unmultiply, 1);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToR8Unmultiply, 1, flipY);
                 break;
             }
             break;
@@ -1479,13 +1550,13 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
             // are chosen from the RGBA data.
             switch (alphaOp) {
             case AlphaDoNothing:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRA8, 2);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRA8, 2, flipY);
                 break;
             case AlphaDoPremultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRA8Premultiply, 2);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRA8Premultiply, 2, flipY);
                 break;
             case AlphaDoUnmultiply:
-                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRA8Unmultiply, 2);
+                doPacking<uint8_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToRA8Unmultiply, 2, flipY);
                 break;
             }
             break;
@@ -1496,13 +1567,13 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
         uint16_t* destination = static_cast<uint16_t*>(destinationData);
         switch (alphaOp) {
         case AlphaDoNothing:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort4444, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort4444, 1, flipY);
             break;
         case AlphaDoPremultiply:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort4444Premultiply, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort4444Premultiply, 1, flipY);
             break;
         case AlphaDoUnmultiply:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort4444Unmultiply, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort4444Unmultiply, 1, flipY);
             break;
         }
         break;
@@ -1511,13 +1582,13 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
         uint16_t* destination = static_cast<uint16_t*>(destinationData);
         switch (alphaOp) {
         case AlphaDoNothing:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort5551, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort5551, 1, flipY);
             break;
         case AlphaDoPremultiply:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort5551Premultiply, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort5551Premultiply, 1, flipY);
             break;
         case AlphaDoUnmultiply:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort5551Unmultiply, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort5551Unmultiply, 1, flipY);
             break;
         }
         break;
@@ -1526,13 +1597,13 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
         uint16_t* destination = static_cast<uint16_t*>(destinationData);
         switch (alphaOp) {
         case AlphaDoNothing:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort565, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort565, 1, flipY);
             break;
         case AlphaDoPremultiply:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort565Premultiply, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort565Premultiply, 1, flipY);
             break;
         case AlphaDoUnmultiply:
-            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort565Unmultiply, 1);
+            doPacking<uint16_t>(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA8ToUnsignedShort565Unmultiply, 1, flipY);
             break;
         }
         break;
@@ -1558,17 +1629,23 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
                 || (sourceDataFormat == SourceFormatRA32F && destinationFormat == LUMINANCE_ALPHA))) {
             // No conversion necessary.
             int numChannels = (sourceDataFormat == SourceFormatRGBA32F ? 4 : 2);
-            memcpy(destinationData, sourceData, width * height * numChannels * sizeof(float));
+            if (!flipY) {
+                memcpy(destinationData, sourceData, width * height * numChannels * sizeof(float));
+                break;
+            }
+            unsigned int rowBytes = width * numChannels * sizeof(float);
+            for (unsigned int row = 0; row < height; ++row)
+                memcpy(destinationRow(static_cast<uint8_t*>(destinationData), row, height, rowBytes, flipY), sourceData + row * rowBytes, rowBytes);
             break;
         }
         switch (destinationFormat) {
         case RGB:
             switch (alphaOp) {
             case AlphaDoNothing:
-                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRGB32F, 3);
+                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRGB32F, 3, flipY);
                 break;
             case AlphaDoPremultiply:
-                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRGB32FPremultiply, 3);
+                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRGB32FPremultiply, 3, flipY);
                 break;
             default:
                 ASSERT_NOT_REACHED();
@@ -1577,13 +1654,13 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
         case RGBA:
             // AlphaDoNothing is handled above with fast path.
             ASSERT(alphaOp == AlphaDoPremultiply);
-            doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRGBA32FPremultiply, 4);
+            doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRGBA32FPremultiply, 4, flipY);
             break;
         case ALPHA:
             // From the desktop OpenGL conversion rules (OpenGL 2.1
             // specification, Table 3.15), the alpha channel is chosen
             // from the RGBA data.
-            doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToA32F, 1);
+            doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToA32F, 1, flipY);
             break;
         case LUMINANCE:
             // From the desktop OpenGL conversion rules (OpenGL 2.1
@@ -1591,10 +1668,10 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
             // from the RGBA data.
             switch (alphaOp) {
             case AlphaDoNothing:
-                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToR32F, 1);
+                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToR32F, 1, flipY);
                 break;
             case AlphaDoPremultiply:
-                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToR32FPremultiply, 1);
+                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToR32FPremultiply, 1, flipY);
                 break;
             default:
                 ASSERT_NOT_REACHED();
@@ -1606,10 +1683,10 @@ bool GraphicsContext3D::packPixels(const uint8_t* sourceData,
             // are chosen from the RGBA data.
             switch (alphaOp) {
             case AlphaDoNothing:
-                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRA32F, 2);
+                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRA32F, 2, flipY);
                 break;
             case AlphaDoPremultiply:
-                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRA32FPremultiply, 2);
+                doFloatingPointPacking(sourceData, sourceDataFormat, width, height, sourceUnpackAlignment, destination, packOneRowOfRGBA32FToRA32FPremultiply, 2, flipY);
                 break;
             default:
                 ASSERT_NOT_REACHED();
@@ -592,13 +592,6 @@ public:
                             const void* pixels,
                             Vector<uint8_t>& data);
 
-    // Flips the given image data vertically, in-place.
-    void flipVertically(void* imageData,
-                        unsigned int width,
-                        unsigned int height,
-                        unsigned int bytesPerPixel,
-                        unsigned int unpackAlignment);
-
     // Attempt to enumerate all possible native image formats to
     // reduce the amount of temporary allocations during texture
     // uploading. This enum must be public because it is accessed
@@ -864,11 +857,12 @@ public:
     // If ignoreGammaAndColorProfile is true, gamma correction and ICC
     // profile won't be applied.
     //
-    // No vertical flip of the image data is performed by this
-    // method.
+    // If flipY is true, the rows of the image data are flipped
+    // vertically as they are packed.
     bool getImageData(Image* image,
                       GC3Denum format,
                       GC3Denum type,
+                      bool flipY,
                       bool premultiplyAlpha,
                       bool ignoreGammaAndColorProfile,
                       Vector<uint8_t>& outputVector);
@@ -886,7 +880,8 @@ public:
     // data into the specified OpenGL destination format and type.
     // A sourceUnpackAlignment of zero indicates that the source
     // data is tightly packed. Non-zero values may take a slow path.
-    // Destination data will have no gaps between rows.
+    // Destination data will have no gaps between rows. If flipY is
+    // true, the rows are written in reverse order.
     bool packPixels(const uint8_t* sourceData,
                     SourceDataFormat sourceDataFormat,
                     unsigned int width,
@@ -895,6 +890,7 @@ public:
                     unsigned int destinationFormat,
                     unsigned int destinationType,
                     AlphaOp alphaOp,
+                    bool flipY,
                     void* destinationData);
 
 #if PLATFORM(MAC) || PLATFORM(GTK) || PLATFORM(QT) || PLATFORM(EFL)
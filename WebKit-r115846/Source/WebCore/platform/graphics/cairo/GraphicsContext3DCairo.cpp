@@ -144,7 +144,7 @@ GraphicsContext3D::~GraphicsContext3D()
     ::glDeleteFramebuffersEXT(1, &m_fbo);
 }
 
-bool GraphicsContext3D::getImageData(Image* image, unsigned int format, unsigned int type, bool premultiplyAlpha, bool ignoreGammaAndColorProfile, Vector<uint8_t>& outputVector)
+bool GraphicsContext3D::getImageData(Image* image, unsigned int format, unsigned int type, bool flipY, bool premultiplyAlpha, bool ignoreGammaAndColorProfile, Vector<uint8_t>& outputVector)
 {
     if (!image)
         return false;
@@ -187,7 +187,7 @@ bool GraphicsContext3D::getImageData(Image* image, unsigned int format, unsigned
 
     outputVector.resize(width * height * 4);
     return packPixels(cairo_image_surface_get_data(imageSurface.get()), SourceFormatBGRA8,
-                      width, height, srcUnpackAlignment, format, type, alphaOp, outputVector.data());
+                      width, height, srcUnpackAlignment, format, type, alphaOp, flipY, outputVector.data());
 }
 
 void GraphicsContext3D::paintToCanvas(const unsigned char* imagePixels, int imageWidth, int imageHeight, int canvasWidth, int canvasHeight, PlatformContextCairo* context)
@@ -92,6 +92,7 @@ static GraphicsContext3D::SourceDataFormat getSourceDataFormat(unsigned int comp
 bool GraphicsContext3D::getImageData(Image* image,
                                      GC3Denum format,
                                      GC3Denum type,
+                                     bool flipY,
                                      bool premultiplyAlpha,
                                      bool ignoreGammaAndColorProfile,
                                      Vector<uint8_t>& outputVector)
@@ -250,7 +251,7 @@ bool GraphicsContext3D::getImageData(Image* image,
             ++srcUnpackAlignment;
     }
     bool rt = packPixels(rgba, srcDataFormat, width, height, srcUnpackAlignment,
-                         format, type, neededAlphaOp, outputVector.data());
+                         format, type, neededAlphaOp, flipY, outputVector.data());
     return rt;
 }
 
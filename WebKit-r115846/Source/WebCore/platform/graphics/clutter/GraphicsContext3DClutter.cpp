@@ -56,7 +56,7 @@ GraphicsContext3D::~GraphicsContext3D()
     notImplemented();
 }
 
-bool GraphicsContext3D::getImageData(Image* image, unsigned int format, unsigned int type, bool premultiplyAlpha, bool ignoreGammaAndColorProfile, Vector<uint8_t>& outputVector)
+bool GraphicsContext3D::getImageData(Image* image, unsigned int format, unsigned int type, bool flipY, bool premultiplyAlpha, bool ignoreGammaAndColorProfile, Vector<uint8_t>& outputVector)
 {
     notImplemented();
     return false;
@@ -822,7 +822,7 @@ void GraphicsContext3D::setContextLostCallback(PassOwnPtr<ContextLostCallback>)
     notImplemented();
 }
 
-bool GraphicsContext3D::getImageData(Image* image, GC3Denum format, GC3Denum type, bool premultiplyAlpha,
+bool GraphicsContext3D::getImageData(Image* image, GC3Denum format, GC3Denum type, bool flipY, bool premultiplyAlpha,
                                      bool ignoreGammaAndColorProfile, Vector<uint8_t>& outputVector)
 {
     notImplemented();
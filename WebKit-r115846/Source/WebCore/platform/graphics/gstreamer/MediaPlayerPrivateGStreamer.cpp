@@ -244,6 +244,7 @@ MediaPlayerPrivateGStreamer::~MediaPlayerPrivateGStreamer()
     if (m_fillTimer.isActive())
         m_fillTimer.stop();
 
+    m_bufferImage = 0;
     if (m_buffer)
         gst_buffer_unref(m_buffer);
     m_buffer = 0;
@@ -1469,6 +1470,8 @@ void MediaPlayerPrivateGStreamer::setVisible(bool visible)
 void MediaPlayerPrivateGStreamer::triggerRepaint(GstBuffer* buffer)
 {
     g_return_if_fail(GST_IS_BUFFER(buffer));
+    // The image wraps the old buffer's memory, so drop it before the buffer goes away.
+    m_bufferImage = 0;
     gst_buffer_replace(&m_buffer, buffer);
     m_player->repaint();
 }
@@ -1484,11 +1487,13 @@ void MediaPlayerPrivateGStreamer::paint(GraphicsContext* context, const IntRect&
     if (!m_buffer)
         return;
 
-    RefPtr<ImageGStreamer> gstImage = ImageGStreamer::createImage(m_buffer);
-    if (!gstImage)
+    // Repaints that are not triggered by a new frame reuse the image wrapping the current buffer.
+    if (!m_bufferImage)
+        m_bufferImage = ImageGStreamer::createImage(m_buffer);
+    if (!m_bufferImage)
         return;
 
-    context->drawImage(reinterpret_cast<Image*>(gstImage->image().get()), ColorSpaceSRGB,
+    context->drawImage(reinterpret_cast<Image*>(m_bufferImage->image().get()), ColorSpaceSRGB,
                        rect, CompositeCopy, DoNotRespectImageOrientation, false);
 }
 
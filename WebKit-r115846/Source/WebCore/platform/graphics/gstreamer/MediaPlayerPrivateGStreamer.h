@@ -43,6 +43,7 @@ class GraphicsContext;
 class IntSize;
 class IntRect;
 class GStreamerGWorld;
+class ImageGStreamer;
 class MediaPlayerPrivateGStreamer;
 
 class MediaPlayerPrivateGStreamer : public MediaPlayerPrivateInterface {
@@ -165,6 +166,7 @@ class MediaPlayerPrivateGStreamer : public MediaPlayerPrivateInterface {
             mutable bool m_isStreaming;
             IntSize m_size;
             GstBuffer* m_buffer;
+            RefPtr<ImageGStreamer> m_bufferImage;
             GstStructure* m_mediaLocations;
             int m_mediaLocationCurrentIndex;
             bool m_resetPipeline;
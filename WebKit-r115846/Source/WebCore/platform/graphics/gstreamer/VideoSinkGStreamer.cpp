@@ -33,6 +33,7 @@
 #include <glib.h>
 #include <gst/gst.h>
 #include <gst/video/video.h>
+#include <string.h>
 #include <wtf/FastAllocBase.h>
 
 static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE("sink",
@@ -211,17 +212,28 @@ webkit_video_sink_render(GstBaseSink* bsink, GstBuffer* buffer)
             for (int y = 0; y < width; y++) {
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
                 alpha = source[3];
-                destination[0] = (source[0] * alpha + 128) / 255;
-                destination[1] = (source[1] * alpha + 128) / 255;
-                destination[2] = (source[2] * alpha + 128) / 255;
-                destination[3] = alpha;
 #else
                 alpha = source[0];
-                destination[0] = alpha;
-                destination[1] = (source[1] * alpha + 128) / 255;
-                destination[2] = (source[2] * alpha + 128) / 255;
-                destination[3] = (source[3] * alpha + 128) / 255;
 #endif
+                // Opaque and fully transparent pixels are by far the most
+                // common ones and premultiply to themselves and to zero.
+                if (alpha == 255)
+                    memcpy(destination, source, 4);
+                else if (!alpha)
+                    memset(destination, 0, 4);
+                else {
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+                    destination[0] = (source[0] * alpha + 128) / 255;
+                    destination[1] = (source[1] * alpha + 128) / 255;
+                    destination[2] = (source[2] * alpha + 128) / 255;
+                    destination[3] = alpha;
+#else
+                    destination[0] = alpha;
+                    destination[1] = (source[1] * alpha + 128) / 255;
+                    destination[2] = (source[2] * alpha + 128) / 255;
+                    destination[3] = (source[3] * alpha + 128) / 255;
+#endif
+                }
                 source += 4;
                 destination += 4;
             }
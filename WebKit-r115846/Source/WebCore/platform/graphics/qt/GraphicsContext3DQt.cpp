@@ -1596,6 +1596,7 @@ Extensions3D* GraphicsContext3D::getExtensions()
 bool GraphicsContext3D::getImageData(Image* image,
                                      GC3Denum format,
                                      GC3Denum type,
+                                     bool flipY,
                                      bool premultiplyAlpha,
                                      bool ignoreGammaAndColorProfile,
                                      Vector<uint8_t>& outputVector)
@@ -1615,7 +1616,7 @@ bool GraphicsContext3D::getImageData(Image* image,
     if (premultiplyAlpha)
         neededAlphaOp = AlphaDoPremultiply;
     outputVector.resize(nativeImage.byteCount());
-    return packPixels(nativeImage.bits(), SourceFormatBGRA8, image->width(), image->height(), 0, format, type, neededAlphaOp, outputVector.data());
+    return packPixels(nativeImage.bits(), SourceFormatBGRA8, image->width(), image->height(), 0, format, type, neededAlphaOp, flipY, outputVector.data());
 }
 
 void GraphicsContext3D::setContextLostCallback(PassOwnPtr<ContextLostCallback>)
@@ -45,6 +45,7 @@ namespace WebCore {
 bool GraphicsContext3D::getImageData(Image* image,
                                      GC3Denum format,
                                      GC3Denum type,
+                                     bool flipY,
                                      bool premultiplyAlpha,
                                      bool ignoreGammaAndColorProfile,
                                      Vector<uint8_t>& outputVector)
@@ -83,7 +84,7 @@ bool GraphicsContext3D::getImageData(Image* image,
     return packPixels(reinterpret_cast<const uint8_t*>(skiaImageRef.getPixels()),
                       SK_B32_SHIFT ? SourceFormatRGBA8 : SourceFormatBGRA8,
                       skiaImageRef.width(), skiaImageRef.height(), 0,
-                      format, type, neededAlphaOp, outputVector.data());
+                      format, type, neededAlphaOp, flipY, outputVector.data());
 }
 
 } // namespace WebCore
@@ -384,6 +384,11 @@ static void sendRequestCallback(GObject* source, GAsyncResult* res, gpointer dat
                               G_PRIORITY_DEFAULT, d->m_cancellable.get(), readCallback, handle.get());
 }
 
+static void derefFormData(gpointer formData)
+{
+    static_cast<FormData*>(formData)->deref();
+}
+
 static bool addFileToSoupMessageBody(SoupMessage* message, const String& fileNameString, size_t offset, size_t lengthToSend, unsigned long& totalBodySize)
 {
     GOwnPtr<GError> error;
@@ -420,12 +425,23 @@ static bool blobIsOutOfDate(const BlobDataItem& blobItem)
     return fileModificationTime != static_cast<time_t>(blobItem.expectedModificationTime);
 }
 
+static void derefRawData(gpointer rawData)
+{
+    static_cast<RawData*>(rawData)->deref();
+}
+
 static void addEncodedBlobItemToSoupMessageBody(SoupMessage* message, const BlobDataItem& blobItem, unsigned long& totalBodySize)
 {
     if (blobItem.type == BlobDataItem::Data) {
         totalBodySize += blobItem.length;
-        soup_message_body_append(message->request_body, SOUP_MEMORY_TEMPORARY,
-                                 blobItem.data->data() + blobItem.offset, blobItem.length);
+        // Hand libsoup the blob's own bytes instead of a copy; the reference is dropped once the chunk is written.
+        blobItem.data->ref();
+        SoupBuffer* soupBuffer = soup_buffer_new_with_owner(blobItem.data->data() + blobItem.offset,
+                                                            blobItem.length,
+                                                            blobItem.data.get(),
+                                                            derefRawData);
+        soup_message_body_append_buffer(message->request_body, soupBuffer);
+        soup_buffer_free(soupBuffer);
         return;
     }
 
@@ -460,8 +476,15 @@ static bool addFormElementsToSoupMessage(SoupMessage* message, const char* conte
 
         if (element.m_type == FormDataElement::data) {
             totalBodySize += element.m_data.size();
-            soup_message_body_append(message->request_body, SOUP_MEMORY_TEMPORARY,
-                                     element.m_data.data(), element.m_data.size());
+            // Reference the element's bytes instead of letting libsoup copy them; the FormData is
+            // kept alive until the chunk has been written.
+            httpBody->ref();
+            SoupBuffer* soupBuffer = soup_buffer_new_with_owner(element.m_data.data(),
+                                                                element.m_data.size(),
+                                                                httpBody,
+                                                                derefFormData);
+            soup_message_body_append_buffer(message->request_body, soupBuffer);
+            soup_buffer_free(soupBuffer);
             continue;
         }
 
@@ -24,6 +24,7 @@
 #include "config.h"
 #include "Base64.h"
 
+#include <algorithm>
 #include <limits.h>
 #include <wtf/StringExtras.h>
 #include <wtf/text/WTFString.h>
@@ -41,23 +42,26 @@ static const char base64EncMap[64] = {
     0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2B, 0x2F
 };
 
-static const char base64DecMap[128] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F,
+// Characters outside the base64 alphabet map to nonAlphabet.
+static const unsigned char nonAlphabet = 0x80;
+
+static const unsigned char base64DecMap[128] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x3E, 0x80, 0x80, 0x80, 0x3F,
     0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B,
-    0x3C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x3C, 0x3D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
     0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
     0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-    0x17, 0x18, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
     0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
     0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
-    0x31, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00
+    0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80
 };
 
 String base64Encode(const char* data, unsigned length, bool insertLFs)
@@ -67,6 +71,15 @@ String base64Encode(const char* data, unsigned length, bool insertLFs)
     return String(result.data(), result.size());
 }
 
+static inline void encodeGroup(const unsigned char* in, char* out)
+{
+    unsigned group = (in[0] << 16) | (in[1] << 8) | in[2];
+    out[0] = base64EncMap[group >> 18];
+    out[1] = base64EncMap[(group >> 12) & 077];
+    out[2] = base64EncMap[(group >> 6) & 077];
+    out[3] = base64EncMap[group & 077];
+}
+
 void base64Encode(const char* data, unsigned len, Vector<char>& out, bool insertLFs)
 {
     out.clear();
@@ -80,9 +93,6 @@ void base64Encode(const char* data, unsigned len, Vector<char>& out, bool insert
     if (len > maxInputBufferSize)
         return;
 
-    unsigned sidx = 0;
-    unsigned didx = 0;
-
     unsigned outLength = ((len + 2) / 3) * 4;
 
     // Deal with the 76 character per line limit specified in RFC 2045.
@@ -90,42 +100,41 @@ void base64Encode(const char* data, unsigned len, Vector<char>& out, bool insert
     if (insertLFs)
         outLength += ((outLength - 1) / 76);
 
-    int count = 0;
     out.grow(outLength);
 
-    // 3-byte to 4-byte conversion + 0-63 to ascii printable conversion
-    if (len > 1) {
-        while (sidx < len - 2) {
-            if (insertLFs) {
-                if (count && !(count % 76))
-                    out[didx++] = '\n';
-                count += 4;
-            }
-            out[didx++] = base64EncMap[(data[sidx] >> 2) & 077];
-            out[didx++] = base64EncMap[((data[sidx + 1] >> 4) & 017) | ((data[sidx] << 4) & 077)];
-            out[didx++] = base64EncMap[((data[sidx + 2] >> 6) & 003) | ((data[sidx + 1] << 2) & 077)];
-            out[didx++] = base64EncMap[data[sidx + 2] & 077];
-            sidx += 3;
+    const unsigned groupsPerLine = 76 / 4;
+    const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+    const unsigned char* end = src + len;
+    char* dst = out.data();
+
+    // 3-byte to 4-byte conversion + 0-63 to ascii printable conversion, one line at a time.
+    unsigned fullGroups = len / 3;
+    while (end - src >= 3) {
+        unsigned groups = (end - src) / 3;
+        if (insertLFs) {
+            if (dst != out.data())
+                *dst++ = '\n';
+            groups = std::min(groups, groupsPerLine);
         }
+        for (const unsigned char* groupsEnd = src + groups * 3; src < groupsEnd; src += 3, dst += 4)
+            encodeGroup(src, dst);
     }
 
-    if (sidx < len) {
-        if (insertLFs && (count > 0) && !(count % 76))
-           out[didx++] = '\n';
-
-        out[didx++] = base64EncMap[(data[sidx] >> 2) & 077];
-        if (sidx < len - 1) {
-            out[didx++] = base64EncMap[((data[sidx + 1] >> 4) & 017) | ((data[sidx] << 4) & 077)];
-            out[didx++] = base64EncMap[(data[sidx + 1] << 2) & 077];
-        } else
-            out[didx++] = base64EncMap[(data[sidx] << 4) & 077];
+    if (src < end) {
+        if (insertLFs && fullGroups && !(fullGroups % groupsPerLine))
+            *dst++ = '\n';
+
+        unsigned group = src[0] << 16;
+        if (end - src > 1)
+            group |= src[1] << 8;
+        dst[0] = base64EncMap[group >> 18];
+        dst[1] = base64EncMap[(group >> 12) & 077];
+        dst[2] = end - src > 1 ? base64EncMap[(group >> 6) & 077] : '=';
+        dst[3] = '=';
+        dst += 4;
     }
 
-    // Add padding
-    while (didx < out.size()) {
-        out[didx] = '=';
-        didx++;
-    }
+    ASSERT_UNUSED(dst, dst == out.data() + out.size());
 }
 
 bool base64Decode(const Vector<char>& in, Vector<char>& out, Base64DecodePolicy policy)
@@ -139,6 +148,12 @@ bool base64Decode(const Vector<char>& in, Vector<char>& out, Base64DecodePolicy
     return base64Decode(in.data(), in.size(), out, policy);
 }
 
+template<typename T>
+static inline unsigned decodeCharacter(T ch)
+{
+    return static_cast<unsigned>(ch) < 128 ? base64DecMap[ch] : nonAlphabet;
+}
+
 template<typename T>
 static inline bool base64DecodeInternal(const T* data, unsigned len, Vector<char>& out, Base64DecodePolicy policy)
 {
@@ -146,56 +161,76 @@ static inline bool base64DecodeInternal(const T* data, unsigned len, Vector<char
     if (!len)
         return true;
 
-    out.grow(len);
+    // Every 4 alphabet characters decode to 3 bytes; a trailing partial group decodes to at most 2.
+    out.grow(len / 4 * 3 + 2);
+
+    const T* src = data;
+    const T* end = data + len;
+    char* dst = out.data();
 
     bool sawEqualsSign = false;
-    unsigned outLength = 0;
-    for (unsigned idx = 0; idx < len; idx++) {
-        unsigned ch = data[idx];
-        if (ch == '=')
-            sawEqualsSign = true;
-        else if (('0' <= ch && ch <= '9') || ('A' <= ch && ch <= 'Z') || ('a' <= ch && ch <= 'z') || ch == '+' || ch == '/') {
+    unsigned sextetCount = 0;
+    unsigned group = 0;
+    while (src < end) {
+        // Fast path: decode whole groups of 4 alphabet characters straight into the output.
+        if (!(sextetCount % 4) && !sawEqualsSign) {
+            while (end - src >= 4) {
+                unsigned a = decodeCharacter(src[0]);
+                unsigned b = decodeCharacter(src[1]);
+                unsigned c = decodeCharacter(src[2]);
+                unsigned d = decodeCharacter(src[3]);
+                if ((a | b | c | d) & nonAlphabet)
+                    break;
+                unsigned bits = (a << 18) | (b << 12) | (c << 6) | d;
+                dst[0] = static_cast<char>(bits >> 16);
+                dst[1] = static_cast<char>(bits >> 8);
+                dst[2] = static_cast<char>(bits);
+                dst += 3;
+                src += 4;
+                sextetCount += 4;
+            }
+            if (src == end)
+                break;
+        }
+
+        unsigned ch = *src++;
+        unsigned value = decodeCharacter(ch);
+        if (value != nonAlphabet) {
             if (sawEqualsSign)
                 return false;
-            out[outLength] = base64DecMap[ch];
-            outLength++;
-        } else if (policy == FailOnInvalidCharacter || (policy == IgnoreWhitespace && !isSpaceOrNewline(ch)))
+            group = (group << 6) | value;
+            if (!(++sextetCount % 4)) {
+                dst[0] = static_cast<char>(group >> 16);
+                dst[1] = static_cast<char>(group >> 8);
+                dst[2] = static_cast<char>(group);
+                dst += 3;
+                group = 0;
+            }
+        } else if (ch == '=')
+            sawEqualsSign = true;
+        else if (policy == FailOnInvalidCharacter || (policy == IgnoreWhitespace && !isSpaceOrNewline(ch)))
             return false;
     }
 
-    if (!outLength)
+    if (!sextetCount) {
+        out.clear();
         return !sawEqualsSign;
+    }
 
     // Valid data is (n * 4 + [0,2,3]) characters long.
-    if ((outLength % 4) == 1)
+    switch (sextetCount % 4) {
+    case 1:
         return false;
-    
-    // 4-byte to 3-byte conversion
-    outLength -= (outLength + 3) / 4;
-    if (!outLength)
-        return false;
-
-    unsigned sidx = 0;
-    unsigned didx = 0;
-    if (outLength > 1) {
-        while (didx < outLength - 2) {
-            out[didx] = (((out[sidx] << 2) & 255) | ((out[sidx + 1] >> 4) & 003));
-            out[didx + 1] = (((out[sidx + 1] << 4) & 255) | ((out[sidx + 2] >> 2) & 017));
-            out[didx + 2] = (((out[sidx + 2] << 6) & 255) | (out[sidx + 3] & 077));
-            sidx += 4;
-            didx += 3;
-        }
+    case 2:
+        *dst++ = static_cast<char>(group >> 4);
+        break;
+    case 3:
+        *dst++ = static_cast<char>(group >> 10);
+        *dst++ = static_cast<char>(group >> 2);
+        break;
     }
 
-    if (didx < outLength)
-        out[didx] = (((out[sidx] << 2) & 255) | ((out[sidx + 1] >> 4) & 003));
-
-    if (++didx < outLength)
-        out[didx] = (((out[sidx + 1] << 4) & 255) | ((out[sidx + 2] >> 2) & 017));
-
-    if (outLength < out.size())
-        out.shrink(outLength);
-
+    out.shrink(dst - out.data());
     return true;
 }
 
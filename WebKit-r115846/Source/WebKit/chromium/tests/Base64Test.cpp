@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2012 Google Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above
+ * copyright notice, this list of conditions and the following disclaimer
+ * in the documentation and/or other materials provided with the
+ * distribution.
+ *     * Neither the name of Google Inc. nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Base64.h"
+
+#include <gtest/gtest.h>
+#include <wtf/Vector.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
+
+using namespace WebCore;
+
+namespace {
+
+CString encode(const char* input, bool insertLFs = false)
+{
+    Vector<char> output;
+    base64Encode(input, strlen(input), output, insertLFs);
+    return CString(output.data(), output.size());
+}
+
+bool decode(const char* input, CString& result, Base64DecodePolicy policy = FailOnInvalidCharacter)
+{
+    Vector<char> output;
+    if (!base64Decode(input, strlen(input), output, policy))
+        return false;
+    result = CString(output.data(), output.size());
+    return true;
+}
+
+TEST(Base64Test, Encode)
+{
+    EXPECT_EQ(0u, encode("").length());
+    EXPECT_EQ(CString("Zg=="), encode("f"));
+    EXPECT_EQ(CString("Zm8="), encode("fo"));
+    EXPECT_EQ(CString("Zm9v"), encode("foo"));
+    EXPECT_EQ(CString("Zm9vYg=="), encode("foob"));
+    EXPECT_EQ(CString("Zm9vYmE="), encode("fooba"));
+    EXPECT_EQ(CString("Zm9vYmFy"), encode("foobar"));
+    EXPECT_EQ(CString("/+8="), encode("\xff\xef"));
+}
+
+TEST(Base64Test, EncodeInsertsLineFeeds)
+{
+    // 57 input bytes fill exactly one 76 character line.
+    Vector<char> input(57 * 2 + 1);
+    input.fill('a');
+    Vector<char> output;
+    base64Encode(input.data(), input.size(), output, true);
+
+    ASSERT_EQ(76u * 2 + 1 + 4 + 1, output.size());
+    EXPECT_EQ('\n', output[76]);
+    EXPECT_EQ('\n', output[76 * 2 + 1]);
+    EXPECT_EQ('=', output.last());
+
+    // No line feed is needed when the output fits on one line.
+    base64Encode(input.data(), 57, output, true);
+    EXPECT_EQ(76u, output.size());
+    EXPECT_EQ(notFound, output.find('\n'));
+}
+
+TEST(Base64Test, Decode)
+{
+    CString result;
+    EXPECT_TRUE(decode("", result));
+    EXPECT_EQ(0u, result.length());
+    EXPECT_TRUE(decode("Zg==", result));
+    EXPECT_EQ(CString("f"), result);
+    EXPECT_TRUE(decode("Zm8=", result));
+    EXPECT_EQ(CString("fo"), result);
+    EXPECT_TRUE(decode("Zm9vYmFy", result));
+    EXPECT_EQ(CString("foobar"), result);
+
+    // Padding is optional.
+    EXPECT_TRUE(decode("Zm9vYg", result));
+    EXPECT_EQ(CString("foob"), result);
+
+    EXPECT_FALSE(decode("Z", result));
+    EXPECT_FALSE(decode("Zm9vY", result));
+    EXPECT_FALSE(decode("Zg==Zg==", result));
+    EXPECT_FALSE(decode("=", result));
+}
+
+TEST(Base64Test, DecodePolicies)
+{
+    CString result;
+    EXPECT_FALSE(decode("Zm9v YmFy", result));
+    EXPECT_TRUE(decode("Zm9v YmFy", result, IgnoreWhitespace));
+    EXPECT_EQ(CString("foobar"), result);
+    EXPECT_TRUE(decode(" Zm\n9vY\tmFy\n", result, IgnoreWhitespace));
+    EXPECT_EQ(CString("foobar"), result);
+    EXPECT_TRUE(decode(" \n", result, IgnoreWhitespace));
+    EXPECT_EQ(0u, result.length());
+
+    EXPECT_FALSE(decode("Zm9v*YmFy", result, IgnoreWhitespace));
+    EXPECT_TRUE(decode("Zm9v*Ym\x80" "Fy", result, IgnoreInvalidCharacters));
+    EXPECT_EQ(CString("foobar"), result);
+}
+
+TEST(Base64Test, DecodeUTF16)
+{
+    Vector<char> output;
+    EXPECT_TRUE(base64Decode(String("Zm9vYmFy"), output));
+    EXPECT_EQ(CString("foobar"), CString(output.data(), output.size()));
+
+    const UChar nonLatin1[] = { 'Z', 'm', 0x0146, '9', 'v' };
+    EXPECT_FALSE(base64Decode(String(nonLatin1, WTF_ARRAY_LENGTH(nonLatin1)), output, IgnoreWhitespace));
+    EXPECT_TRUE(base64Decode(String(nonLatin1, WTF_ARRAY_LENGTH(nonLatin1)), output, IgnoreInvalidCharacters));
+    EXPECT_EQ(CString("foo"), CString(output.data(), output.size()));
+}
+
+TEST(Base64Test, RoundTrip)
+{
+    Vector<char> input;
+    for (unsigned i = 0; i < 1000; ++i)
+        input.append(static_cast<char>(i * 7919));
+
+    for (unsigned length = 0; length <= input.size(); length += 37) {
+        for (int insertLFs = 0; insertLFs < 2; ++insertLFs) {
+            Vector<char> encoded;
+            base64Encode(input.data(), length, encoded, insertLFs);
+            Vector<char> decoded;
+            ASSERT_TRUE(base64Decode(encoded, decoded, insertLFs ? IgnoreWhitespace : FailOnInvalidCharacter));
+            ASSERT_EQ(length, decoded.size());
+            EXPECT_EQ(0, memcmp(input.data(), decoded.data(), length));
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2012 Google Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1.  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE AND ITS CONTRIBUTORS "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL APPLE OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "FileReaderLoader.h"
+
+#include "KURL.h"
+#include "ResourceResponse.h"
+#include <gtest/gtest.h>
+#include <string.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
+
+using namespace WebCore;
+
+namespace {
+
+// Drives the loader the way a blob load does, without a client. stringResult() is called between
+// chunks, as a FileReader progress handler reading reader.result would.
+class FileReaderLoaderTest : public testing::Test {
+protected:
+    void startLoading(FileReaderLoader& loader, const char* data)
+    {
+        ResourceResponse response(KURL(ParsedURLString, "blob:test"), "text/plain", strlen(data), String(), String());
+        response.setHTTPStatusCode(200);
+        loader.didReceiveResponse(0, response);
+    }
+};
+
+TEST_F(FileReaderLoaderTest, DataURLReadFromProgressEventWithSingleChunk)
+{
+    const char* data = "Hello";
+    FileReaderLoader loader(FileReaderLoader::ReadAsDataURL, 0);
+    loader.setDataType("text/plain");
+    startLoading(loader, data);
+
+    loader.didReceiveData(data, strlen(data));
+    loader.stringResult();
+    loader.didFinishLoading(0, 0);
+    EXPECT_STREQ("data:text/plain;base64,SGVsbG8=", loader.stringResult().utf8().data());
+}
+
+TEST_F(FileReaderLoaderTest, DataURLReadFromProgressEventWithSeveralChunks)
+{
+    const char* data = "Hello";
+    FileReaderLoader loader(FileReaderLoader::ReadAsDataURL, 0);
+    loader.setDataType("text/plain");
+    startLoading(loader, data);
+
+    loader.didReceiveData(data, 2);
+    EXPECT_STREQ("", loader.stringResult().utf8().data());
+    loader.didReceiveData(data + 2, 3);
+    loader.stringResult();
+    loader.didFinishLoading(0, 0);
+    EXPECT_STREQ("data:text/plain;base64,SGVsbG8=", loader.stringResult().utf8().data());
+}
+
+TEST_F(FileReaderLoaderTest, TextReadFromProgressEventWithTruncatedUTF8Tail)
+{
+    // "abc" followed by the first two bytes of the three byte encoding of U+20AC.
+    const char* data = "abc\xE2\x82";
+    FileReaderLoader loader(FileReaderLoader::ReadAsText, 0);
+    loader.setEncoding("UTF-8");
+    startLoading(loader, data);
+
+    loader.didReceiveData(data, strlen(data));
+    loader.stringResult();
+    loader.didFinishLoading(0, 0);
+    String result = loader.stringResult();
+    ASSERT_EQ(4u, result.length());
+    EXPECT_STREQ("abc", result.left(3).utf8().data());
+    EXPECT_EQ(0xFFFD, result[3]);
+}
+
+TEST_F(FileReaderLoaderTest, TextReadFromProgressEventsAcrossSplitSequence)
+{
+    // "a", U+20AC split across two chunks, then "b".
+    const char* data = "a\xE2\x82\xAC" "b";
+    FileReaderLoader loader(FileReaderLoader::ReadAsText, 0);
+    loader.setEncoding("UTF-8");
+    startLoading(loader, data);
+
+    loader.didReceiveData(data, 2);
+    EXPECT_STREQ("a", loader.stringResult().utf8().data());
+    loader.didReceiveData(data + 2, 3);
+    loader.stringResult();
+    loader.didFinishLoading(0, 0);
+    String result = loader.stringResult();
+    ASSERT_EQ(3u, result.length());
+    EXPECT_EQ('a', result[0]);
+    EXPECT_EQ(0x20AC, result[1]);
+    EXPECT_EQ('b', result[2]);
+}
+
+} // namespace
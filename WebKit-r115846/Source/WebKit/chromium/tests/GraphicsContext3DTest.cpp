@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2012 Google Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1.  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE AND ITS CONTRIBUTORS "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL APPLE OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "GraphicsContext3D.h"
+
+#include "FakeWebGraphicsContext3D.h"
+#include "GraphicsContext3DPrivate.h"
+#include "Image.h"
+#include "NativeImageSkia.h"
+#include "SkColorPriv.h"
+
+#include <gtest/gtest.h>
+#include <wtf/Vector.h>
+
+using namespace WebCore;
+using namespace WebKit;
+
+namespace {
+
+// Widths which exercise both the vectorized loops and their scalar tails.
+const unsigned testWidths[] = { 1, 3, 4, 7, 8, 9, 16, 31, 64 };
+const unsigned testHeight = 5;
+
+PassRefPtr<GraphicsContext3D> createContext()
+{
+    return GraphicsContext3DPrivate::createGraphicsContextFromWebContext(adoptPtr(new FakeWebGraphicsContext3D()), GraphicsContext3D::RenderDirectlyToHostWindow);
+}
+
+template<typename T>
+void fillWithPattern(Vector<T>& data)
+{
+    uint32_t seed = 0x12345678;
+    for (size_t i = 0; i < data.size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = static_cast<T>(seed >> 16);
+    }
+}
+
+// An Image backed by a Skia bitmap with no encoded data behind it.
+class TestImage : public Image {
+public:
+    static PassRefPtr<TestImage> create(const SkBitmap& bitmap)
+    {
+        return adoptRef(new TestImage(bitmap));
+    }
+
+    virtual IntSize size() const { return IntSize(m_nativeImage.bitmap().width(), m_nativeImage.bitmap().height()); }
+    virtual NativeImagePtr nativeImageForCurrentFrame() { return &m_nativeImage; }
+    virtual void destroyDecodedData(bool) { }
+    virtual unsigned decodedSize() const { return 0; }
+    virtual void draw(GraphicsContext*, const FloatRect&, const FloatRect&, ColorSpace, CompositeOperator) { }
+
+private:
+    explicit TestImage(const SkBitmap& bitmap)
+        : Image(0)
+        , m_nativeImage(bitmap)
+    {
+    }
+
+    NativeImageSkia m_nativeImage;
+};
+
+template<typename T>
+bool rowsAreFlipped(const T* flipped, const T* original, unsigned elementsPerRow, unsigned height)
+{
+    for (unsigned i = 0; i < height; ++i) {
+        if (memcmp(flipped + i * elementsPerRow, original + (height - i - 1) * elementsPerRow, elementsPerRow * sizeof(T)))
+            return false;
+    }
+    return true;
+}
+
+void testPackedShortRoundTrip(GC3Denum format, GC3Denum type)
+{
+    RefPtr<GraphicsContext3D> context = createContext();
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(testWidths); ++i) {
+        unsigned width = testWidths[i];
+        Vector<uint16_t> source(width * testHeight);
+        fillWithPattern(source);
+
+        // Unpacking to RGBA8 and packing back is lossless for these formats.
+        Vector<uint8_t> data;
+        ASSERT_TRUE(context->extractTextureData(width, testHeight, format, type, 2, false, false, source.data(), data));
+        ASSERT_EQ(source.size() * sizeof(uint16_t), data.size());
+        EXPECT_EQ(0, memcmp(source.data(), data.data(), data.size())) << "width " << width;
+
+        ASSERT_TRUE(context->extractTextureData(width, testHeight, format, type, 2, true, false, source.data(), data));
+        ASSERT_EQ(source.size() * sizeof(uint16_t), data.size());
+        EXPECT_TRUE(rowsAreFlipped(reinterpret_cast<const uint16_t*>(data.data()), source.data(), width, testHeight)) << "width " << width;
+    }
+}
+
+TEST(GraphicsContext3DTest, PackUnsignedShort565)
+{
+    testPackedShortRoundTrip(GraphicsContext3D::RGB, GraphicsContext3D::UNSIGNED_SHORT_5_6_5);
+}
+
+TEST(GraphicsContext3DTest, PackUnsignedShort4444)
+{
+    testPackedShortRoundTrip(GraphicsContext3D::RGBA, GraphicsContext3D::UNSIGNED_SHORT_4_4_4_4);
+}
+
+TEST(GraphicsContext3DTest, PackUnsignedShort5551)
+{
+    testPackedShortRoundTrip(GraphicsContext3D::RGBA, GraphicsContext3D::UNSIGNED_SHORT_5_5_5_1);
+}
+
+TEST(GraphicsContext3DTest, PremultiplyRGBA8)
+{
+    RefPtr<GraphicsContext3D> context = createContext();
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(testWidths); ++i) {
+        unsigned width = testWidths[i];
+        Vector<uint8_t> source(width * testHeight * 4);
+        fillWithPattern(source);
+
+        Vector<uint8_t> expected(source.size());
+        for (size_t j = 0; j < source.size(); j += 4) {
+            float scaleFactor = source[j + 3] / 255.0f;
+            expected[j] = static_cast<uint8_t>(static_cast<float>(source[j]) * scaleFactor);
+            expected[j + 1] = static_cast<uint8_t>(static_cast<float>(source[j + 1]) * scaleFactor);
+            expected[j + 2] = static_cast<uint8_t>(static_cast<float>(source[j + 2]) * scaleFactor);
+            expected[j + 3] = source[j + 3];
+        }
+
+        Vector<uint8_t> data;
+        ASSERT_TRUE(context->extractTextureData(width, testHeight, GraphicsContext3D::RGBA, GraphicsContext3D::UNSIGNED_BYTE, 1, false, true, source.data(), data));
+        ASSERT_EQ(expected.size(), data.size());
+        EXPECT_EQ(0, memcmp(expected.data(), data.data(), data.size())) << "width " << width;
+
+        ASSERT_TRUE(context->extractTextureData(width, testHeight, GraphicsContext3D::RGBA, GraphicsContext3D::UNSIGNED_BYTE, 1, true, true, source.data(), data));
+        ASSERT_EQ(expected.size(), data.size());
+        EXPECT_TRUE(rowsAreFlipped(data.data(), expected.data(), width * 4, testHeight)) << "width " << width;
+    }
+}
+
+TEST(GraphicsContext3DTest, UnpackSkiaImage)
+{
+    // Skia stores BGRA on most platforms, in which case this goes through the
+    // BGRA8 to RGBA8 unpacking.
+    RefPtr<GraphicsContext3D> context = createContext();
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(testWidths); ++i) {
+        unsigned width = testWidths[i];
+        Vector<uint32_t> pixels(width * testHeight);
+        fillWithPattern(pixels);
+
+        SkBitmap bitmap;
+        bitmap.setConfig(SkBitmap::kARGB_8888_Config, width, testHeight);
+        bitmap.allocPixels();
+        bitmap.setIsOpaque(false);
+        Vector<uint8_t> expected(pixels.size() * 4);
+        {
+            SkAutoLockPixels lock(bitmap);
+            memcpy(bitmap.getPixels(), pixels.data(), pixels.size() * sizeof(uint32_t));
+        }
+        for (size_t j = 0; j < pixels.size(); ++j) {
+            expected[j * 4] = SkGetPackedR32(pixels[j]);
+            expected[j * 4 + 1] = SkGetPackedG32(pixels[j]);
+            expected[j * 4 + 2] = SkGetPackedB32(pixels[j]);
+            expected[j * 4 + 3] = SkGetPackedA32(pixels[j]);
+        }
+
+        // The image already holds premultiplied data, so asking for
+        // premultiplied output unpacks it without any alpha operation.
+        RefPtr<TestImage> image = TestImage::create(bitmap);
+        Vector<uint8_t> data;
+        ASSERT_TRUE(context->extractImageData(image.get(), GraphicsContext3D::RGBA, GraphicsContext3D::UNSIGNED_BYTE, false, true, false, data));
+        ASSERT_EQ(expected.size(), data.size());
+        EXPECT_EQ(0, memcmp(expected.data(), data.data(), data.size())) << "width " << width;
+
+        ASSERT_TRUE(context->extractImageData(image.get(), GraphicsContext3D::RGBA, GraphicsContext3D::UNSIGNED_BYTE, true, true, false, data));
+        ASSERT_EQ(expected.size(), data.size());
+        EXPECT_TRUE(rowsAreFlipped(data.data(), expected.data(), width * 4, testHeight)) << "width " << width;
+    }
+}
+
+TEST(GraphicsContext3DTest, FlipWithoutConversion)
+{
+    RefPtr<GraphicsContext3D> context = createContext();
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(testWidths); ++i) {
+        unsigned width = testWidths[i];
+        Vector<uint8_t> source(width * testHeight * 4);
+        fillWithPattern(source);
+
+        Vector<uint8_t> data;
+        ASSERT_TRUE(context->extractTextureData(width, testHeight, GraphicsContext3D::RGBA, GraphicsContext3D::UNSIGNED_BYTE, 4, true, false, source.data(), data));
+        ASSERT_EQ(source.size(), data.size());
+        EXPECT_TRUE(rowsAreFlipped(data.data(), source.data(), width * 4, testHeight)) << "width " << width;
+    }
+}
+
+} // namespace
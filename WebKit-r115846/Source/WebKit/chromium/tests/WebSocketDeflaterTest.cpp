@@ -29,6 +29,8 @@
 
 #include <gtest/gtest.h>
 #include <wtf/Vector.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
 
 using namespace WebCore;
 
@@ -154,4 +156,71 @@ TEST(WebSocketDeflaterTest, TestLargeData)
     EXPECT_EQ(0, memcmp(inputData.data(), inflater->data(), inflater->size()));
 }
 
+TEST(WebSocketDeflaterTest, TestMemLevel)
+{
+    Vector<char> inputData(64 * 1024);
+    for (size_t i = 0; i < inputData.size(); ++i)
+        inputData[i] = static_cast<char>(i * i % 251);
+
+    for (int memLevel = 1; memLevel <= 9; memLevel += 4) {
+        OwnPtr<WebSocketDeflater> deflater = WebSocketDeflater::create(15, WebSocketDeflater::TakeOverContext, memLevel);
+        ASSERT_TRUE(deflater->initialize());
+        ASSERT_TRUE(deflater->addBytes(inputData.data(), inputData.size()));
+        ASSERT_TRUE(deflater->finish());
+
+        OwnPtr<WebSocketInflater> inflater = WebSocketInflater::create();
+        ASSERT_TRUE(inflater->initialize());
+        ASSERT_TRUE(inflater->addBytes(deflater->data(), deflater->size()));
+        ASSERT_TRUE(inflater->finish());
+        EXPECT_EQ(inputData.size(), inflater->size());
+        EXPECT_EQ(0, memcmp(inputData.data(), inflater->data(), inflater->size()));
+    }
+}
+
+TEST(WebSocketDeflaterTest, TestManyMessagesAfterLargeMessage)
+{
+    OwnPtr<WebSocketDeflater> deflater = WebSocketDeflater::create(15);
+    ASSERT_TRUE(deflater->initialize());
+    OwnPtr<WebSocketInflater> inflater = WebSocketInflater::create();
+    ASSERT_TRUE(inflater->initialize());
+
+    // A large message first, so that the buffers are released on reset rather than reused.
+    Vector<char> largeData(1024 * 1024);
+    largeData.fill('x');
+    ASSERT_TRUE(deflater->addBytes(largeData.data(), largeData.size()));
+    ASSERT_TRUE(deflater->finish());
+    ASSERT_TRUE(inflater->addBytes(deflater->data(), deflater->size()));
+    ASSERT_TRUE(inflater->finish());
+    EXPECT_EQ(largeData.size(), inflater->size());
+    EXPECT_EQ(0, memcmp(largeData.data(), inflater->data(), inflater->size()));
+    deflater->reset();
+    inflater->reset();
+    EXPECT_EQ(0u, deflater->capacity());
+    EXPECT_EQ(0u, inflater->capacity());
+
+    // Then many small messages which reuse the retained buffers.
+    size_t deflaterCapacity = 0;
+    size_t inflaterCapacity = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+        String message = "message " + String::number(i);
+        CString inputData = message.utf8();
+        ASSERT_TRUE(deflater->addBytes(inputData.data(), inputData.length()));
+        ASSERT_TRUE(deflater->finish());
+        ASSERT_TRUE(inflater->addBytes(deflater->data(), deflater->size()));
+        ASSERT_TRUE(inflater->finish());
+        EXPECT_EQ(inputData.length(), inflater->size());
+        EXPECT_EQ(0, memcmp(inputData.data(), inflater->data(), inflater->size()));
+        deflater->reset();
+        inflater->reset();
+        if (!i) {
+            deflaterCapacity = deflater->capacity();
+            inflaterCapacity = inflater->capacity();
+            EXPECT_LT(0u, deflaterCapacity);
+            EXPECT_LT(0u, inflaterCapacity);
+        }
+        EXPECT_EQ(deflaterCapacity, deflater->capacity());
+        EXPECT_EQ(inflaterCapacity, inflater->capacity());
+    }
+}
+
 }
@@ -256,8 +256,15 @@ extern EXP_INITIALIZE_GLOBAL_CALLBACKS  ExpInitializeCallback[];
 
 extern FAST_MUTEX       ExpEnvironmentLock;
 
+VOID
+ExpTrimPoolLookasideList (
+    IN PNPAGED_LOOKASIDE_LIST Lookaside,
+    IN ULONG Depth
+    );
+
 extern NPAGED_LOOKASIDE_LIST ExpSmallPagedPoolLookasideLists[POOL_SMALL_LISTS];
 extern NPAGED_LOOKASIDE_LIST ExpSmallNPagedPoolLookasideLists[POOL_SMALL_LISTS];
+extern PPOOL_MAGAZINE ExpPoolMagazines[MAXIMUM_PROCESSORS];
 
 extern LIST_ENTRY ExNPagedLookasideListHead;
 extern KSPIN_LOCK ExNPagedLookasideLock;
@@ -38,6 +38,13 @@ Revision History:
 
 #define MINIMUM_ALLOCATION_THRESHOLD 25
 
+//
+// Define the number of bytes each pool magazine lookaside list may cache at
+// its maximum depth.
+//
+
+#define POOL_MAGAZINE_BYTES PAGE_SIZE
+
 //
 // Define forward referenced function prototypes.
 //
@@ -68,6 +75,11 @@ ExpScanPoolLookasideList (
     IN PLIST_ENTRY ListHead
     );
 
+LOGICAL
+ExpScanPoolMagazines (
+    VOID
+    );
+
 //
 // Define the global nonpaged and paged lookaside list data.
 //
@@ -136,6 +148,12 @@ Return Value:
 
         Changes |= ExpScanPoolLookasideList(&ExPoolLookasideListHead);
 
+        //
+        // Scan the per processor pool magazines.
+        //
+
+        Changes |= ExpScanPoolMagazines();
+
         //
         // If any changes were made to the depth of any lookaside list during
         // this scan period, then lower the scan period to the minimum value.
@@ -404,6 +422,159 @@ Return Value:
     return Changes;
 }
 
+LOGICAL
+ExpScanPoolMagazines (
+    VOID
+    )
+
+/*++
+
+Routine Description:
+
+    This function creates a pool magazine for each processor that does not
+    have one yet and adjusts the maximum depth of the lookaside lists in each
+    pool magazine as necessary. Blocks cached beyond the new depth of a list
+    are returned to pool, and a list that had no allocations during the scan
+    period returns all of its blocks, so that their pool pages can coalesce
+    and be released to memory management.
+
+    N.B. Pool magazines are created here rather than during pool
+         initialization since this function runs periodically at passive
+         level once all processors have been started.
+
+Arguments:
+
+    None.
+
+Return Value:
+
+    A value of TRUE is returned if the maximum depth of any lookaside list
+    is changed. Otherwise, a value of FALSE is returned.
+
+--*/
+
+{
+
+    ULONG Allocates;
+    LOGICAL Changes;
+    ULONG Index;
+    PNPAGED_LOOKASIDE_LIST Lookaside;
+    PPOOL_MAGAZINE Magazine;
+    ULONG MaximumDepth;
+    ULONG Misses;
+    PLIST_ENTRY NextEntry;
+    ULONG Number;
+    ULONG Size;
+
+    Changes = FALSE;
+    for (Number = 0; Number < (ULONG)KeNumberProcessors; Number += 1) {
+        Magazine = ExpPoolMagazines[Number];
+        if (Magazine == NULL) {
+            Magazine = ExAllocatePoolWithTag(NonPagedPool,
+                                             sizeof(POOL_MAGAZINE),
+                                             'gaMP');
+
+            if (Magazine == NULL) {
+                continue;
+            }
+
+            //
+            // Initialize a paged and a nonpaged lookaside list for each
+            // block size. The maximum depth of each list is limited so that
+            // a list caches at most a page of pool, but at least one block.
+            //
+
+            InitializeListHead(&Magazine->ListHead);
+            for (Index = 0; Index < (2 * POOL_MAGAZINE_LISTS); Index += 1) {
+                if (Index < POOL_MAGAZINE_LISTS) {
+                    Lookaside = &Magazine->NonPagedLookaside[Index];
+                    Lookaside->L.Type = NonPagedPool;
+                    Size = (Index + POOL_SMALL_LISTS + 1) << POOL_BLOCK_SHIFT;
+
+                } else {
+                    Lookaside = &Magazine->PagedLookaside[Index - POOL_MAGAZINE_LISTS];
+                    Lookaside->L.Type = PagedPool;
+                    Size = (Index - POOL_MAGAZINE_LISTS + POOL_SMALL_LISTS + 1) << POOL_BLOCK_SHIFT;
+                }
+
+                MaximumDepth = POOL_MAGAZINE_BYTES / Size;
+                if (MaximumDepth == 0) {
+                    MaximumDepth = 1;
+                }
+
+                ExInitializeSListHead(&Lookaside->L.ListHead);
+                Lookaside->L.Depth = MINIMUM_LOOKASIDE_DEPTH;
+                if (Lookaside->L.Depth > MaximumDepth) {
+                    Lookaside->L.Depth = (USHORT)MaximumDepth;
+                }
+
+                Lookaside->L.MaximumDepth = (USHORT)MaximumDepth;
+                Lookaside->L.TotalAllocates = 0;
+                Lookaside->L.AllocateHits = 0;
+                Lookaside->L.TotalFrees = 0;
+                Lookaside->L.FreeHits = 0;
+                Lookaside->L.Tag = 'looP';
+                Lookaside->L.Size = Size;
+                Lookaside->L.Allocate = NULL;
+                Lookaside->L.Free = NULL;
+                Lookaside->L.LastTotalAllocates = 0;
+                Lookaside->L.LastAllocateHits = 0;
+                KeInitializeSpinLock(&Lookaside->Lock);
+                InsertTailList(&Magazine->ListHead, &Lookaside->L.ListEntry);
+            }
+
+            //
+            // Make the pool magazine visible to the pool allocator only
+            // after all of its lookaside lists have been initialized.
+            //
+
+            InterlockedExchangePointer(&ExpPoolMagazines[Number], Magazine);
+        }
+
+        //
+        // Adjust the depth of each lookaside list in the pool magazine and
+        // trim the blocks cached beyond the new depth.
+        //
+
+        NextEntry = Magazine->ListHead.Flink;
+        while (NextEntry != &Magazine->ListHead) {
+            Lookaside = CONTAINING_RECORD(NextEntry,
+                                          NPAGED_LOOKASIDE_LIST,
+                                          L.ListEntry);
+
+            Allocates = Lookaside->L.TotalAllocates - Lookaside->L.LastTotalAllocates;
+            Lookaside->L.LastTotalAllocates = Lookaside->L.TotalAllocates;
+            Misses = Allocates - (Lookaside->L.AllocateHits - Lookaside->L.LastAllocateHits);
+            Lookaside->L.LastAllocateHits = Lookaside->L.AllocateHits;
+
+            Changes |= ExpComputeLookasideDepth(Allocates,
+                                                Misses,
+                                                Lookaside->L.MaximumDepth,
+                                                &Lookaside->L.Depth);
+
+            //
+            // The minimum lookaside depth may exceed the maximum depth of a
+            // list of large blocks.
+            //
+
+            if (Lookaside->L.Depth > Lookaside->L.MaximumDepth) {
+                Lookaside->L.Depth = Lookaside->L.MaximumDepth;
+            }
+
+            if (Allocates == 0) {
+                ExpTrimPoolLookasideList(Lookaside, 0);
+
+            } else {
+                ExpTrimPoolLookasideList(Lookaside, Lookaside->L.Depth);
+            }
+
+            NextEntry = NextEntry->Flink;
+        }
+    }
+
+    return Changes;
+}
+
 VOID
 ExInitializeNPagedLookasideList (
     IN PNPAGED_LOOKASIDE_LIST Lookaside,
@@ -327,6 +327,14 @@ ExpSnapShotPoolPages(
     IN OUT PULONG RequiredLength
     );
 
+VOID
+ExpFreePoolBlock (
+    IN PPOOL_DESCRIPTOR PoolDesc,
+    IN PPOOL_HEADER Entry,
+    IN POOL_TYPE CheckType,
+    IN LOGICAL GlobalSpace
+    );
+
 #ifdef ALLOC_PRAGMA
 #pragma alloc_text(INIT, InitializePool)
 #pragma alloc_text(PAGE, ExpInitializePoolDescriptor)
@@ -335,6 +343,8 @@ ExpSnapShotPoolPages(
 #pragma alloc_text(POOLCODE, ExAllocatePoolWithTag)
 #pragma alloc_text(POOLCODE, ExFreePool)
 #pragma alloc_text(POOLCODE, ExFreePoolWithTag)
+#pragma alloc_text(POOLCODE, ExpFreePoolBlock)
+#pragma alloc_text(PAGE, ExpTrimPoolLookasideList)
 #if DBG
 #pragma alloc_text(PAGELK, ExSnapShotPool)
 #pragma alloc_text(PAGELK, ExpSnapShotPoolPages)
@@ -484,6 +494,14 @@ NPAGED_LOOKASIDE_LIST ExpSmallNPagedPoolLookasideLists[POOL_SMALL_LISTS];
 
 NPAGED_LOOKASIDE_LIST ExpSmallPagedPoolLookasideLists[POOL_SMALL_LISTS];
 
+//
+// Define per processor pool magazines. A magazine is created for each
+// processor by the periodic lookaside depth adjustment and caches the blocks
+// that are too large for the small pool lookaside lists.
+//
+
+PPOOL_MAGAZINE ExpPoolMagazines[MAXIMUM_PROCESSORS];
+
 
 //
 // LOCK_POOL and LOCK_IF_PAGED_POOL are only used within this module.
@@ -1166,6 +1184,7 @@ Return Value:
     PVOID Block;
     PPOOL_HEADER Entry;
     PNPAGED_LOOKASIDE_LIST LookasideList;
+    PPOOL_MAGAZINE Magazine;
     PPOOL_HEADER NextEntry;
     PPOOL_HEADER SplitEntry;
     KIRQL LockHandle;
@@ -1422,28 +1441,20 @@ RetryWithMustSucceed:
         // If the requested pool block is a small block, then attempt to
         // allocate the requested pool from the per processor lookaside
         // list. If the attempt fails, then attempt to allocate from the
-        // system lookaside list. If the attempt fails, then select a
-        // pool to allocate from and allocate the block normally.
+        // system lookaside list. If the requested pool block is larger
+        // than a small block, then attempt to allocate it from the pool
+        // magazine of the current processor. If the attempt fails, then
+        // select a pool to allocate from and allocate the block normally.
         //
         // Session space allocations do not currently use lookaside lists.
         //
 
         if ((GlobalSpace == TRUE) &&
-            (NeededSize <= POOL_SMALL_LISTS) &&
             (Isx86FeaturePresent(KF_CMPXCHG8B))) {
 
             Prcb = KeGetCurrentPrcb();
-            LookasideList = Prcb->PPPagedLookasideList[NeededSize - 1].P;
-            LookasideList->L.TotalAllocates += 1;
-
-            CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, Entry);
-
-            Entry = (PPOOL_HEADER)
-                ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
-                                            &LookasideList->Lock);
-
-            if (Entry == NULL) {
-                LookasideList = Prcb->PPPagedLookasideList[NeededSize - 1].L;
+            if (NeededSize <= POOL_SMALL_LISTS) {
+                LookasideList = Prcb->PPPagedLookasideList[NeededSize - 1].P;
                 LookasideList->L.TotalAllocates += 1;
 
                 CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, Entry);
@@ -1451,6 +1462,33 @@ RetryWithMustSucceed:
                 Entry = (PPOOL_HEADER)
                     ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
                                                 &LookasideList->Lock);
+
+                if (Entry == NULL) {
+                    LookasideList = Prcb->PPPagedLookasideList[NeededSize - 1].L;
+                    LookasideList->L.TotalAllocates += 1;
+
+                    CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, Entry);
+
+                    Entry = (PPOOL_HEADER)
+                        ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
+                                                    &LookasideList->Lock);
+                }
+
+            } else {
+                Entry = NULL;
+                Magazine = ExpPoolMagazines[Prcb->Number];
+                if (Magazine != NULL) {
+                    ASSERT(NeededSize < POOL_LIST_HEADS);
+
+                    LookasideList = &Magazine->PagedLookaside[NeededSize - (POOL_SMALL_LISTS + 1)];
+                    LookasideList->L.TotalAllocates += 1;
+
+                    CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, Entry);
+
+                    Entry = (PPOOL_HEADER)
+                        ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
+                                                    &LookasideList->Lock);
+                }
             }
 
             if (Entry != NULL) {
@@ -1567,30 +1605,50 @@ PoolLocked:
         // If the requested pool block is a small block, then attempt to
         // allocate the requested pool from the per processor lookaside
         // list. If the attempt fails, then attempt to allocate from the
-        // system lookaside list. If the attempt fails, then select a
-        // pool to allocate from and allocate the block normally.
+        // system lookaside list. If the requested pool block is larger
+        // than a small block, then attempt to allocate it from the pool
+        // magazine of the current processor. If the attempt fails, then
+        // select a pool to allocate from and allocate the block normally.
         //
 
-        if (GlobalSpace == TRUE && NeededSize <= POOL_SMALL_LISTS) {
+        if (GlobalSpace == TRUE) {
             Prcb = KeGetCurrentPrcb();
-            LookasideList = Prcb->PPNPagedLookasideList[NeededSize - 1].P;
-            LookasideList->L.TotalAllocates += 1;
-
-            CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, 0);
-
-            Entry = (PPOOL_HEADER)
-                        ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
-                                                    &LookasideList->Lock);
-
-            if (Entry == NULL) {
-                LookasideList = Prcb->PPNPagedLookasideList[NeededSize - 1].L;
+            if (NeededSize <= POOL_SMALL_LISTS) {
+                LookasideList = Prcb->PPNPagedLookasideList[NeededSize - 1].P;
                 LookasideList->L.TotalAllocates += 1;
 
                 CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, 0);
 
                 Entry = (PPOOL_HEADER)
+                            ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
+                                                        &LookasideList->Lock);
+
+                if (Entry == NULL) {
+                    LookasideList = Prcb->PPNPagedLookasideList[NeededSize - 1].L;
+                    LookasideList->L.TotalAllocates += 1;
+
+                    CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, 0);
+
+                    Entry = (PPOOL_HEADER)
+                            ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
+                                                        &LookasideList->Lock);
+                }
+
+            } else {
+                Entry = NULL;
+                Magazine = ExpPoolMagazines[Prcb->Number];
+                if (Magazine != NULL) {
+                    ASSERT(NeededSize < POOL_LIST_HEADS);
+
+                    LookasideList = &Magazine->NonPagedLookaside[NeededSize - (POOL_SMALL_LISTS + 1)];
+                    LookasideList->L.TotalAllocates += 1;
+
+                    CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, 0);
+
+                    Entry = (PPOOL_HEADER)
                         ExInterlockedPopEntrySList (&LookasideList->L.ListHead,
                                                     &LookasideList->Lock);
+                }
             }
 
             if (Entry != NULL) {
@@ -2796,12 +2854,11 @@ Return Value:
     ULONG Index;
     KIRQL LockHandle;
     PNPAGED_LOOKASIDE_LIST LookasideList;
-    PPOOL_HEADER NextEntry;
+    PPOOL_MAGAZINE Magazine;
     ULONG PoolIndex;
     POOL_TYPE PoolType;
     PPOOL_DESCRIPTOR PoolDesc;
     PEPROCESS ProcessBilled;
-    LOGICAL Combined;
     ULONG BigPages;
     ULONG Tag;
     LOGICAL GlobalSpace;
@@ -3090,8 +3147,10 @@ Return Value:
 
     //
     // If the pool block is a small block, then attempt to free the block
-    // to the single entry lookaside list. If the free attempt fails, then
-    // free the block by merging it back into the pool data structures.
+    // to the single entry lookaside list. If the pool block is larger than
+    // a small block, then attempt to free the block to the pool magazine of
+    // the current processor. If the free attempt fails, then free the block
+    // by merging it back into the pool data structures.
     //
 
     PoolIndex = DECODE_POOL_INDEX(Entry);
@@ -3189,10 +3248,99 @@ Return Value:
                 }
             }
         }
+
+    } else if (GlobalSpace == TRUE) {
+
+        //
+        // Attempt to free the block to the pool magazine of the current
+        // processor. As with small blocks, must succeed buffers are never
+        // cached.
+        //
+
+        Prcb = KeGetCurrentPrcb();
+        Magazine = ExpPoolMagazines[Prcb->Number];
+        if ((Magazine != NULL) &&
+            (PoolType != NonPagedPoolMustSucceed) &&
+            ((CheckType != PagedPool) || Isx86FeaturePresent(KF_CMPXCHG8B))) {
+
+            ASSERT(Index < POOL_LIST_HEADS);
+
+            if (CheckType == PagedPool) {
+                LookasideList = &Magazine->PagedLookaside[Index - (POOL_SMALL_LISTS + 1)];
+
+            } else {
+                LookasideList = &Magazine->NonPagedLookaside[Index - (POOL_SMALL_LISTS + 1)];
+            }
+
+            LookasideList->L.TotalFrees += 1;
+
+            CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, P);
+
+            if (ExQueryDepthSList(&LookasideList->L.ListHead) < LookasideList->L.Depth) {
+                LookasideList->L.FreeHits += 1;
+                Entry += 1;
+                ExInterlockedPushEntrySList(&LookasideList->L.ListHead,
+                                            (PSINGLE_LIST_ENTRY)Entry,
+                                            &LookasideList->Lock);
+
+                CHECK_LOOKASIDE_LIST(__LINE__, LookasideList, P);
+
+                return;
+            }
+        }
     }
 
     ASSERT(PoolIndex == PoolDesc->PoolIndex);
 
+    ExpFreePoolBlock(PoolDesc, Entry, CheckType, GlobalSpace);
+    return;
+}
+
+VOID
+ExpFreePoolBlock (
+    IN PPOOL_DESCRIPTOR PoolDesc,
+    IN PPOOL_HEADER Entry,
+    IN POOL_TYPE CheckType,
+    IN LOGICAL GlobalSpace
+    )
+
+/*++
+
+Routine Description:
+
+    This function merges a released pool block back into the pool data
+    structures of the specified pool descriptor. The block is combined with
+    any free neighbors and, if the whole page becomes free, the page is
+    returned to memory management.
+
+Arguments:
+
+    PoolDesc - Supplies a pointer to the pool descriptor that owns the block.
+
+    Entry - Supplies a pointer to the pool header of the block.
+
+    CheckType - Supplies the base pool type of the block.
+
+    GlobalSpace - Supplies TRUE if the block is not in session space.
+
+Return Value:
+
+    None.
+
+--*/
+
+{
+
+    LOGICAL Combined;
+    ULONG Index;
+    KIRQL LockHandle;
+    PPOOL_HEADER NextEntry;
+    ULONG PoolIndex;
+
+    PoolIndex = DECODE_POOL_INDEX(Entry);
+
+    ASSERT(PoolIndex == PoolDesc->PoolIndex);
+
     LOCK_POOL(PoolDesc, LockHandle);
 
     CHECK_POOL_HEADER(__LINE__, Entry);
@@ -3217,10 +3365,10 @@ Return Value:
 
             Combined = TRUE;
 
-            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD)), P);
+            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD)), Entry);
             PrivateRemoveEntryList(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD)));
-            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Flink), P);
-            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Blink), P);
+            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Flink), Entry);
+            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Blink), Entry);
 
             Entry->BlockSize += NextEntry->BlockSize;
         }
@@ -3240,10 +3388,10 @@ Return Value:
 
             Combined = TRUE;
 
-            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD)), P);
+            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD)), Entry);
             PrivateRemoveEntryList(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD)));
-            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Flink), P);
-            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Blink), P);
+            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Flink), Entry);
+            CHECK_LIST(__LINE__, DecodeLink(((PLIST_ENTRY)((PCHAR)NextEntry + POOL_OVERHEAD))->Blink), Entry);
 
             NextEntry->BlockSize += Entry->BlockSize;
             Entry = NextEntry;
@@ -3306,23 +3454,79 @@ Return Value:
             // neighbors for this will be freed before this is reallocated.
             //
 
-            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], P);
+            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], Entry);
             PrivateInsertTailList(&PoolDesc->ListHeads[Index - 1], ((PLIST_ENTRY)((PCHAR)Entry + POOL_OVERHEAD)));
-            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], P);
-            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)Entry + POOL_OVERHEAD)), P);
+            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], Entry);
+            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)Entry + POOL_OVERHEAD)), Entry);
 
         } else {
 
-            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], P);
+            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], Entry);
             PrivateInsertHeadList(&PoolDesc->ListHeads[Index - 1], ((PLIST_ENTRY)((PCHAR)Entry + POOL_OVERHEAD)));
-            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], P);
-            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)Entry + POOL_OVERHEAD)), P);
+            CHECK_LIST(__LINE__, &PoolDesc->ListHeads[Index - 1], Entry);
+            CHECK_LIST(__LINE__, ((PLIST_ENTRY)((PCHAR)Entry + POOL_OVERHEAD)), Entry);
         }
     }
 
     UNLOCK_POOL(PoolDesc, LockHandle);
 }
 
+VOID
+ExpTrimPoolLookasideList (
+    IN PNPAGED_LOOKASIDE_LIST Lookaside,
+    IN ULONG Depth
+    )
+
+/*++
+
+Routine Description:
+
+    This function returns the blocks cached in a pool magazine lookaside
+    list beyond the specified depth to the pool they were allocated from.
+
+    N.B. The blocks are merged directly into the pool descriptor rather
+         than freed with ExFreePool, which would only cache them again.
+
+Arguments:
+
+    Lookaside - Supplies a pointer to a pool magazine lookaside list.
+
+    Depth - Supplies the number of blocks that may remain in the list.
+
+Return Value:
+
+    None.
+
+--*/
+
+{
+
+    POOL_TYPE CheckType;
+    PPOOL_HEADER Entry;
+    PPOOL_DESCRIPTOR PoolDesc;
+
+    CheckType = Lookaside->L.Type & BASE_POOL_TYPE_MASK;
+    while (ExQueryDepthSList(&Lookaside->L.ListHead) > Depth) {
+        Entry = (PPOOL_HEADER)ExInterlockedPopEntrySList(&Lookaside->L.ListHead,
+                                                         &Lookaside->Lock);
+
+        if (Entry == NULL) {
+            break;
+        }
+
+        Entry -= 1;
+
+        PoolDesc = PoolVector[CheckType];
+        if (CheckType == PagedPool) {
+            PoolDesc = &PoolDesc[DECODE_POOL_INDEX(Entry)];
+        }
+
+        ExpFreePoolBlock(PoolDesc, Entry, CheckType, TRUE);
+    }
+
+    return;
+}
+
 
 ULONG
 ExQueryPoolBlockSize (
@@ -3416,6 +3620,7 @@ ExQueryPoolUsage(
 {
     ULONG Index;
     PNPAGED_LOOKASIDE_LIST Lookaside;
+    PPOOL_MAGAZINE Magazine;
     PLIST_ENTRY NextEntry;
     PPOOL_DESCRIPTOR pd;
 
@@ -3472,6 +3677,31 @@ ExQueryPoolUsage(
         NextEntry = NextEntry->Flink;
     }
 
+    //
+    // Sum the lookaside hits for the per processor pool magazines.
+    //
+
+    for (Index = 0; Index < (ULONG)KeNumberProcessors; Index += 1) {
+        Magazine = ExpPoolMagazines[Index];
+        if (Magazine != NULL) {
+            NextEntry = Magazine->ListHead.Flink;
+            while (NextEntry != &Magazine->ListHead) {
+                Lookaside = CONTAINING_RECORD(NextEntry,
+                                              NPAGED_LOOKASIDE_LIST,
+                                              L.ListEntry);
+
+                if (Lookaside->L.Type == NonPagedPool) {
+                    *NonPagedPoolLookasideHits += Lookaside->L.AllocateHits;
+
+                } else {
+                    *PagedPoolLookasideHits += Lookaside->L.AllocateHits;
+                }
+
+                NextEntry = NextEntry->Flink;
+            }
+        }
+    }
+
     return;
 }
 
@@ -56,6 +56,18 @@ Revision History:
 
 #define DisablePriorityBoost 0x08
 
+//
+// Define adaptive spin level field.
+//
+// N.B. The spin level of a resource is kept in otherwise unused bits of the
+//      flag field. Each failed spin raises the level and halves the number
+//      of times the next contending exclusive acquire spins, and each
+//      successful spin lowers it again.
+//
+
+#define ResourceSpinLevelShift 8
+#define ResourceSpinLevelMask 0x0700
+
 //
 // Define resource assertion macro.
 //
@@ -94,6 +106,16 @@ ExpFindCurrentThread(
     IN PERESOURCE Resource,
     IN ERESOURCE_THREAD CurrentThread
     );
+
+#if !defined(NT_UP)
+
+VOID
+FASTCALL
+ExpSpinForResource (
+    IN PERESOURCE Resource
+    );
+
+#endif
 
 //
 // Resource wait time out value.
@@ -107,6 +129,13 @@ LARGE_INTEGER ExpTimeout;
 
 ULONG ExpResourceTimeoutCount = 648000;
 
+//
+// Number of times a contending exclusive acquire spins at the lowest spin
+// level before waiting.
+//
+
+ULONG ExpResourceSpinCount = 4096;
+
 //
 // Global spinlock to guard access to resource lists.
 //
@@ -469,6 +498,53 @@ Return Value:
         return ExAcquireResourceExclusiveLite(Resource, TRUE);
     }
 
+#if !defined(NT_UP)
+
+    //
+    // If there are no waiters, then the resource may only be held for a
+    // short time by a thread running on another processor. Spin for a
+    // while, with the fast lock released, waiting for the resource to be
+    // released before paying for a wait and a context switch.
+    //
+    // N.B. If there are waiters, then ownership is handed directly to the
+    //      next waiter when the resource is released and spinning can
+    //      never succeed.
+    //
+
+    if ((KeNumberProcessors > 1) &&
+        (IsExclusiveWaiting(Resource) == FALSE) &&
+        (IsSharedWaiting(Resource) == FALSE)) {
+
+        ExReleaseFastLock(&Resource->SpinLock, OldIrql);
+        ExpSpinForResource(Resource);
+        ExAcquireFastLock(&Resource->SpinLock, &OldIrql);
+
+        //
+        // If the resource is no longer owned, then grant exclusive access
+        // and lower the spin level. Otherwise, raise the spin level and
+        // wait.
+        //
+
+        if (Resource->ActiveCount == 0) {
+            if ((Resource->Flag & ResourceSpinLevelMask) != 0) {
+                Resource->Flag -= (1 << ResourceSpinLevelShift);
+            }
+
+            Resource->Flag |= ResourceOwnedExclusive;
+            Resource->OwnerThreads[0].OwnerThread = (ERESOURCE_THREAD)PsGetCurrentThread();
+            Resource->OwnerThreads[0].OwnerCount = 1;
+            Resource->ActiveCount = 1;
+            ExReleaseFastLock(&Resource->SpinLock, OldIrql);
+            return TRUE;
+        }
+
+        if ((Resource->Flag & ResourceSpinLevelMask) != ResourceSpinLevelMask) {
+            Resource->Flag += (1 << ResourceSpinLevelShift);
+        }
+    }
+
+#endif
+
     //
     // Wait for exclusive access to the resource to be granted and set the
     // owner thread.
@@ -2678,6 +2754,70 @@ Return Value:
     return;
 }
 
+#if !defined(NT_UP)
+
+VOID
+FASTCALL
+ExpSpinForResource (
+    IN PERESOURCE Resource
+    )
+
+/*++
+
+Routine Description:
+
+    This function spins waiting for the specified resource to be released.
+    The number of iterations is ExpResourceSpinCount scaled down by the
+    spin level of the resource. Spinning stops early if another thread
+    starts waiting for the resource or the exclusive owner changes, since
+    in either case the resource will not become free for the caller.
+
+    N.B. This function is called with the resource fast lock not held and
+         reads the resource state without synchronization. The caller must
+         recheck the state with the fast lock held, since the resource may
+         be released or acquired again at any time after spinning stops.
+
+Arguments:
+
+    Resource - Supplies a pointer to the resource to spin on.
+
+Return Value:
+
+    None.
+
+--*/
+
+{
+
+    ERESOURCE_THREAD OwnerThread;
+    ULONG SpinCount;
+    volatile ERESOURCE *Volatile;
+
+    Volatile = Resource;
+    OwnerThread = Volatile->OwnerThreads[0].OwnerThread;
+    SpinCount = ExpResourceSpinCount >>
+                ((Volatile->Flag & ResourceSpinLevelMask) >> ResourceSpinLevelShift);
+
+    while (SpinCount != 0) {
+        if (Volatile->ActiveCount == 0) {
+            break;
+        }
+
+        if ((Volatile->NumberOfExclusiveWaiters != 0) ||
+            (Volatile->NumberOfSharedWaiters != 0) ||
+            (Volatile->OwnerThreads[0].OwnerThread != OwnerThread)) {
+            break;
+        }
+
+        KeYieldProcessor();
+        SpinCount -= 1;
+    }
+
+    return;
+}
+
+#endif
+
 POWNER_ENTRY
 FASTCALL
 ExpFindCurrentThread(
@@ -2711,6 +2851,7 @@ Return Value:
 {
 
     POWNER_ENTRY FreeEntry;
+    ULONG Index;
     ULONG NewSize;
     ULONG OldSize;
     POWNER_ENTRY OwnerEntry;
@@ -2742,6 +2883,27 @@ Return Value:
 
         } else {
             OldSize = OwnerEntry->TableSize;
+
+            //
+            // Check the owner table entry the current thread last used
+            // before searching the whole table. If that entry is owned by
+            // the specified thread, then it is returned immediately. When
+            // the specified thread is zero, this matches a free entry.
+            //
+            // N.B. This only shortens the search for a thread that already
+            //      owns the resource, e.g., a recursive shared acquire while
+            //      a large number of threads own the resource shared. A
+            //      thread that does not own the resource must still search
+            //      the whole table to be sure that it has no entry.
+            //
+
+            Index = KeGetCurrentThread()->ResourceIndex;
+            if ((Index != 0) &&
+                (Index < OldSize) &&
+                (OwnerEntry[Index].OwnerThread == CurrentThread)) {
+                return &OwnerEntry[Index];
+            }
+
             OwnerBound = &OwnerEntry[OldSize];
             OwnerEntry += 1;
             do {
@@ -378,9 +378,15 @@ typedef struct _HEAP {
     //  means the heap is not locked.  Each lock operation increments the
     //  heap count and each unlock decrements the counter
     //
+    //  The lookaside array holds (LookasideSlotMask + 1) slots of
+    //  HEAP_MAXIMUM_FREELISTS lists each.  A thread only uses the slot
+    //  selected by its thread id, so threads allocating and freeing the
+    //  same size do not all contend for one list head.
+    //
 
     PVOID Lookaside;
     ULONG LookasideLockCount;
+    ULONG LookasideSlotMask;
 
 } HEAP, *PHEAP;
 
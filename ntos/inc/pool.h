@@ -126,6 +126,24 @@ typedef struct _POOL_DESCRIPTOR {
     LIST_ENTRY ListHeads[POOL_LIST_HEADS];
 } POOL_DESCRIPTOR, *PPOOL_DESCRIPTOR;
 
+//
+// Define per processor pool magazine structure.
+//
+// A pool magazine holds a paged and a nonpaged lookaside list for each
+// block size that is too large for the small pool lookaside lists in the
+// processor control block, up to the largest block carved from a pool page.
+// The lookaside lists are linked through their list entries so the maximum
+// depth of each can be adjusted dynamically.
+//
+
+#define POOL_MAGAZINE_LISTS (POOL_LIST_HEADS - (POOL_SMALL_LISTS + 1))
+
+typedef struct _POOL_MAGAZINE {
+    LIST_ENTRY ListHead;
+    NPAGED_LOOKASIDE_LIST NonPagedLookaside[POOL_MAGAZINE_LISTS];
+    NPAGED_LOOKASIDE_LIST PagedLookaside[POOL_MAGAZINE_LISTS];
+} POOL_MAGAZINE, *PPOOL_MAGAZINE;
+
 //
 //      Caveat Programmer:
 //
@@ -0,0 +1,1260 @@
+/*++
+
+Copyright (c) 1990  Microsoft Corporation
+
+Module Name:
+
+    AvlTable.c
+
+Abstract:
+
+    This module implements a variant of the generic table package that
+    keeps its elements in a height balanced (AVL) tree instead of a splay
+    tree.  The interface mirrors the one in gentable.c.
+
+    The splay tree based table restructures the tree on every lookup and
+    enumeration, so even a read only caller writes to the tree and must
+    hold the table lock exclusive.  The balanced table never changes the
+    shape of the tree except on insert and delete, which keeps the tree
+    depth within 1.44 log2(n).
+
+    Only the lookup routines and RtlEnumerateGenericTableWithoutSplayingAvl
+    leave the table untouched and may run with the table lock held shared.
+    RtlEnumerateGenericTableAvl and RtlGetElementGenericTableAvl remember
+    their position in the table, so like insert and delete they need the
+    lock held exclusive.
+
+Environment:
+
+    Pure Utility Routines
+
+Revision History:
+
+--*/
+
+#include "ntrtlp.h"
+
+#pragma pack(8)
+
+//
+// This structure is the header for a balanced table entry.
+// Align this structure on a 8 byte boundary so the user
+// data is correctly aligned.
+//
+
+typedef struct _AVL_TABLE_ENTRY_HEADER {
+
+    RTL_BALANCED_LINKS BalancedLinks;
+    LONGLONG UserData;
+
+} AVL_TABLE_ENTRY_HEADER, *PAVL_TABLE_ENTRY_HEADER;
+
+#pragma pack()
+
+//
+//  The root of the tree is always the right child of the BalancedRoot
+//  links in the table header.  This way every node in the tree has a
+//  parent and the rotations need not special case the root.
+//
+
+#define AvlRoot(Table) ((Table)->BalancedRoot.RightChild)
+
+#define AvlUserData(Links) ((PVOID)&((PAVL_TABLE_ENTRY_HEADER)(Links))->UserData)
+
+
+static
+TABLE_SEARCH_RESULT
+FindNodeOrParentAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID Buffer,
+    OUT PRTL_BALANCED_LINKS *NodeOrParent
+    )
+
+/*++
+
+Routine Description:
+
+    This routine is used by all of the routines of the balanced
+    table package to locate the a node in the tree.  It will
+    find and return (via the NodeOrParent parameter) the node
+    with the given key, or if that node is not in the tree it
+    will return (via the NodeOrParent parameter) a pointer to
+    the parent.  The tree is not modified.
+
+Arguments:
+
+    Table - The balanced table to search for the key.
+
+    Buffer - Pointer to a buffer holding the key.  The table
+             package doesn't examine the key itself.  It leaves
+             this up to the user supplied compare routine.
+
+    NodeOrParent - Will be set to point to the node containing the
+                   the key or what should be the parent of the node
+                   if it were in the tree.  Note that this will *NOT*
+                   be set if the search result is TableEmptyTree.
+
+Return Value:
+
+    TABLE_SEARCH_RESULT - As for the splay tree based generic table.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS NodeToExamine;
+    PRTL_BALANCED_LINKS Child;
+    RTL_GENERIC_COMPARE_RESULTS Result;
+
+    NodeToExamine = AvlRoot(Table);
+
+    if (NodeToExamine == NULL) {
+
+        return TableEmptyTree;
+    }
+
+    while (TRUE) {
+
+        //
+        // Compare the buffer with the key in the tree element.
+        //
+
+        Result = Table->CompareRoutine(
+                     Table,
+                     Buffer,
+                     AvlUserData(NodeToExamine)
+                     );
+
+        if (Result == GenericLessThan) {
+
+            if (Child = NodeToExamine->LeftChild) {
+
+                NodeToExamine = Child;
+
+            } else {
+
+                *NodeOrParent = NodeToExamine;
+                return TableInsertAsLeft;
+            }
+
+        } else if (Result == GenericGreaterThan) {
+
+            if (Child = NodeToExamine->RightChild) {
+
+                NodeToExamine = Child;
+
+            } else {
+
+                *NodeOrParent = NodeToExamine;
+                return TableInsertAsRight;
+            }
+
+        } else {
+
+            ASSERT(Result == GenericEqual);
+
+            *NodeOrParent = NodeToExamine;
+            return TableFoundNode;
+        }
+    }
+}
+
+
+static
+PRTL_BALANCED_LINKS
+RealSuccessorAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PRTL_BALANCED_LINKS Links
+    )
+
+/*++
+
+Routine Description:
+
+    This routine returns the node that follows Links in collating order,
+    or NULL if Links is the last node in the tree.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS Ptr;
+
+    //
+    //  If there is a right subtree then the successor is its leftmost node.
+    //
+
+    if (Ptr = Links->RightChild) {
+
+        while (Ptr->LeftChild != NULL) {
+
+            Ptr = Ptr->LeftChild;
+        }
+
+        return Ptr;
+    }
+
+    //
+    //  Otherwise walk up until we arrive from a left child.  If we reach
+    //  the table header first there is no successor.
+    //
+
+    Ptr = Links;
+
+    while ((Ptr->Parent != &Table->BalancedRoot) && (Ptr->Parent->RightChild == Ptr)) {
+
+        Ptr = Ptr->Parent;
+    }
+
+    return ((Ptr->Parent == &Table->BalancedRoot) ? NULL : Ptr->Parent);
+}
+
+
+static
+PRTL_BALANCED_LINKS
+RealPredecessorAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PRTL_BALANCED_LINKS Links
+    )
+
+/*++
+
+Routine Description:
+
+    This routine returns the node that precedes Links in collating order,
+    or NULL if Links is the first node in the tree.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS Ptr;
+
+    if (Ptr = Links->LeftChild) {
+
+        while (Ptr->RightChild != NULL) {
+
+            Ptr = Ptr->RightChild;
+        }
+
+        return Ptr;
+    }
+
+    Ptr = Links;
+
+    while ((Ptr->Parent != &Table->BalancedRoot) && (Ptr->Parent->LeftChild == Ptr)) {
+
+        Ptr = Ptr->Parent;
+    }
+
+    return ((Ptr->Parent == &Table->BalancedRoot) ? NULL : Ptr->Parent);
+}
+
+
+static
+VOID
+ReplaceChildAvl (
+    IN PRTL_BALANCED_LINKS Parent,
+    IN PRTL_BALANCED_LINKS OldChild,
+    IN PRTL_BALANCED_LINKS NewChild
+    )
+
+/*++
+
+Routine Description:
+
+    This routine makes NewChild take the place of OldChild under Parent.
+
+--*/
+
+{
+    if (Parent->LeftChild == OldChild) {
+
+        Parent->LeftChild = NewChild;
+
+    } else {
+
+        ASSERT(Parent->RightChild == OldChild);
+
+        Parent->RightChild = NewChild;
+    }
+
+    if (NewChild != NULL) {
+
+        NewChild->Parent = Parent;
+    }
+}
+
+
+static
+PRTL_BALANCED_LINKS
+RebalanceNodeAvl (
+    IN PRTL_BALANCED_LINKS Node
+    )
+
+/*++
+
+Routine Description:
+
+    This routine restores the balance of a subtree whose root is out of
+    balance by two, with either a single or a double rotation.  The
+    balance of a node is the height of its right subtree minus the height
+    of its left subtree.
+
+Arguments:
+
+    Node - Supplies the root of the subtree, whose Balance is -2 or +2.
+
+Return Value:
+
+    PRTL_BALANCED_LINKS - The new root of the subtree.  If its Balance is
+        zero the subtree is now one level shorter than it was before the
+        rotation.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS Parent;
+    PRTL_BALANCED_LINKS Child;
+    PRTL_BALANCED_LINKS GrandChild;
+
+    Parent = Node->Parent;
+
+    if (Node->Balance > 0) {
+
+        Child = Node->RightChild;
+
+        if (Child->Balance >= 0) {
+
+            //
+            //  Single left rotation.  The right child becomes the root of
+            //  the subtree and Node takes over its left subtree.
+            //
+
+            Node->RightChild = Child->LeftChild;
+            if (Node->RightChild != NULL) { Node->RightChild->Parent = Node; }
+
+            Child->LeftChild = Node;
+            Node->Parent = Child;
+
+            ReplaceChildAvl( Parent, Node, Child );
+
+            if (Child->Balance == 0) {
+
+                //
+                //  Only possible after a delete, the height is unchanged.
+                //
+
+                Node->Balance = 1;
+                Child->Balance = -1;
+
+            } else {
+
+                Node->Balance = 0;
+                Child->Balance = 0;
+            }
+
+            return Child;
+        }
+
+        //
+        //  Double rotation.  The left child of the right child becomes the
+        //  root of the subtree.
+        //
+
+        GrandChild = Child->LeftChild;
+
+        Node->RightChild = GrandChild->LeftChild;
+        if (Node->RightChild != NULL) { Node->RightChild->Parent = Node; }
+
+        Child->LeftChild = GrandChild->RightChild;
+        if (Child->LeftChild != NULL) { Child->LeftChild->Parent = Child; }
+
+        GrandChild->LeftChild = Node;
+        Node->Parent = GrandChild;
+
+        GrandChild->RightChild = Child;
+        Child->Parent = GrandChild;
+
+    } else {
+
+        ASSERT(Node->Balance < 0);
+
+        Child = Node->LeftChild;
+
+        if (Child->Balance <= 0) {
+
+            //
+            //  Single right rotation, the mirror of the case above.
+            //
+
+            Node->LeftChild = Child->RightChild;
+            if (Node->LeftChild != NULL) { Node->LeftChild->Parent = Node; }
+
+            Child->RightChild = Node;
+            Node->Parent = Child;
+
+            ReplaceChildAvl( Parent, Node, Child );
+
+            if (Child->Balance == 0) {
+
+                Node->Balance = -1;
+                Child->Balance = 1;
+
+            } else {
+
+                Node->Balance = 0;
+                Child->Balance = 0;
+            }
+
+            return Child;
+        }
+
+        GrandChild = Child->RightChild;
+
+        Node->LeftChild = GrandChild->RightChild;
+        if (Node->LeftChild != NULL) { Node->LeftChild->Parent = Node; }
+
+        Child->RightChild = GrandChild->LeftChild;
+        if (Child->RightChild != NULL) { Child->RightChild->Parent = Child; }
+
+        GrandChild->RightChild = Node;
+        Node->Parent = GrandChild;
+
+        GrandChild->LeftChild = Child;
+        Child->Parent = GrandChild;
+    }
+
+    ReplaceChildAvl( Parent, Node, GrandChild );
+
+    //
+    //  Fix up the balances of the two nodes that now hang off of the
+    //  grandchild.  Whichever side of the grandchild was taller is the
+    //  side that received the extra level.
+    //
+
+    if (GrandChild->Balance == 0) {
+
+        Node->Balance = 0;
+        Child->Balance = 0;
+
+    } else if ((GrandChild->Balance > 0) == (Node->Balance > 0)) {
+
+        //
+        //  The grandchild leaned the same way as Node so the subtree it
+        //  gave to Node is the shorter one.
+        //
+
+        Node->Balance = -GrandChild->Balance;
+        Child->Balance = 0;
+
+    } else {
+
+        Node->Balance = 0;
+        Child->Balance = -GrandChild->Balance;
+    }
+
+    GrandChild->Balance = 0;
+
+    return GrandChild;
+}
+
+
+VOID
+RtlInitializeGenericTableAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PRTL_AVL_COMPARE_ROUTINE CompareRoutine,
+    IN PRTL_AVL_ALLOCATE_ROUTINE AllocateRoutine,
+    IN PRTL_AVL_FREE_ROUTINE FreeRoutine,
+    IN PVOID TableContext
+    )
+
+/*++
+
+Routine Description:
+
+    The procedure InitializeGenericTableAvl takes as input an uninitialized
+    balanced table variable and pointers to the three user supplied routines.
+    This must be called for every individual balanced table variable before
+    it can be used.
+
+Arguments:
+
+    Table - Pointer to the balanced table to be initialized.
+
+    CompareRoutine - User routine to be used to compare to keys in the
+                     table.
+
+    AllocateRoutine - User routine to call to allocate memory for a new
+                      node in the balanced table.
+
+    FreeRoutine - User routine to call to deallocate memory for
+                        a node in the balanced table.
+
+    TableContext - Supplies user supplied context for the table.
+
+Return Value:
+
+    None.
+
+--*/
+
+{
+    RtlZeroMemory( &Table->BalancedRoot, sizeof(RTL_BALANCED_LINKS) );
+
+    Table->BalancedRoot.Parent = &Table->BalancedRoot;
+    Table->OrderedPointer = NULL;
+    Table->WhichOrderedElement = 0;
+    Table->NumberGenericTableElements = 0;
+    Table->RestartKey = NULL;
+    Table->DeleteCount = 0;
+    Table->CompareRoutine = CompareRoutine;
+    Table->AllocateRoutine = AllocateRoutine;
+    Table->FreeRoutine = FreeRoutine;
+    Table->TableContext = TableContext;
+}
+
+
+PVOID
+RtlInsertElementGenericTableAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID Buffer,
+    IN CLONG BufferSize,
+    OUT PBOOLEAN NewElement OPTIONAL
+    )
+
+/*++
+
+Routine Description:
+
+    The function InsertElementGenericTableAvl will insert a new element
+    in a table.  It behaves exactly like RtlInsertElementGenericTable
+    except that the table is kept balanced instead of being splayed.
+
+Arguments:
+
+    Table - Pointer to the table in which to (possibly) insert the
+            key buffer.
+
+    Buffer - Passed to the user comparasion routine.  Its contents are
+             up to the user but one could imagine that it contains some
+             sort of key value.
+
+    BufferSize - The amount of space to allocate when the (possible)
+                 insertion is made.  The size of the balanced links is
+                 added to this.
+
+    NewElement - Optional Flag.  If present then it will be set to
+                 TRUE if the buffer was not "found" in the balanced
+                 table.
+
+Return Value:
+
+    PVOID - Pointer to the user defined data.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS NodeOrParent;
+    TABLE_SEARCH_RESULT Lookup;
+
+    Lookup = FindNodeOrParentAvl(
+                 Table,
+                 Buffer,
+                 &NodeOrParent
+                 );
+
+    return RtlInsertElementGenericTableFullAvl(
+                Table,
+                Buffer,
+                BufferSize,
+                NewElement,
+                NodeOrParent,
+                Lookup
+                );
+}
+
+
+PVOID
+RtlInsertElementGenericTableFullAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID Buffer,
+    IN CLONG BufferSize,
+    OUT PBOOLEAN NewElement OPTIONAL,
+    IN PVOID NodeOrParent,
+    IN TABLE_SEARCH_RESULT SearchResult
+    )
+
+/*++
+
+Routine Description:
+
+    The function InsertElementGenericTableFullAvl will insert a new element
+    in a table, given the NodeOrParent and SearchResult from a previous
+    RtlLookupElementGenericTableFullAvl.
+
+Arguments:
+
+    Table - Pointer to the table in which to (possibly) insert the
+            key buffer.
+
+    Buffer - Passed to the user comparasion routine.
+
+    BufferSize - The amount of space to allocate when the (possible)
+                 insertion is made.
+
+    NewElement - Optional Flag.  If present then it will be set to
+                 TRUE if the buffer was not "found" in the balanced
+                 table.
+
+    NodeOrParent - Result of prior RtlLookupElementGenericTableFullAvl.
+
+    SearchResult - Result of prior RtlLookupElementGenericTableFullAvl.
+
+Return Value:
+
+    PVOID - Pointer to the user defined data.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS NodeToReturn;
+    PRTL_BALANCED_LINKS Child;
+    PRTL_BALANCED_LINKS Parent;
+
+    if (SearchResult == TableFoundNode) {
+
+        if (ARGUMENT_PRESENT(NewElement)) {
+
+            *NewElement = FALSE;
+        }
+
+        return AvlUserData(NodeOrParent);
+    }
+
+    //
+    // We just check that the table isn't getting
+    // too big.
+    //
+
+    ASSERT(Table->NumberGenericTableElements != (MAXULONG-1));
+
+    NodeToReturn = Table->AllocateRoutine(
+                       Table,
+                       BufferSize+FIELD_OFFSET( AVL_TABLE_ENTRY_HEADER, UserData )
+                       );
+
+    if (NodeToReturn == NULL) {
+
+        if (ARGUMENT_PRESENT(NewElement)) {
+
+            *NewElement = FALSE;
+        }
+
+        return NULL;
+    }
+
+    RtlZeroMemory( NodeToReturn, sizeof(RTL_BALANCED_LINKS) );
+
+    Table->NumberGenericTableElements++;
+
+    //
+    //  Any cached ordinal position may now be off by one.
+    //
+
+    Table->OrderedPointer = NULL;
+    Table->WhichOrderedElement = 0;
+
+    //
+    // Insert the new node in the tree.
+    //
+
+    if (SearchResult == TableEmptyTree) {
+
+        AvlRoot(Table) = NodeToReturn;
+        NodeToReturn->Parent = &Table->BalancedRoot;
+
+    } else {
+
+        Parent = NodeOrParent;
+
+        if (SearchResult == TableInsertAsLeft) {
+
+            Parent->LeftChild = NodeToReturn;
+
+        } else {
+
+            Parent->RightChild = NodeToReturn;
+        }
+
+        NodeToReturn->Parent = Parent;
+
+        //
+        //  Walk back up the tree adjusting the balance of each ancestor.
+        //  We can stop as soon as a subtree does not grow taller, and at
+        //  most one rotation is needed.
+        //
+
+        Child = NodeToReturn;
+
+        while (Parent != &Table->BalancedRoot) {
+
+            if (Parent->LeftChild == Child) {
+
+                Parent->Balance -= 1;
+
+            } else {
+
+                Parent->Balance += 1;
+            }
+
+            if (Parent->Balance == 0) {
+
+                break;
+            }
+
+            if ((Parent->Balance == 2) || (Parent->Balance == -2)) {
+
+                (VOID)RebalanceNodeAvl( Parent );
+                break;
+            }
+
+            Child = Parent;
+            Parent = Parent->Parent;
+        }
+    }
+
+    //
+    // Copy the users buffer into the user data area of the table.
+    //
+
+    RtlCopyMemory(
+        AvlUserData(NodeToReturn),
+        Buffer,
+        BufferSize
+        );
+
+    if (ARGUMENT_PRESENT(NewElement)) {
+
+        *NewElement = TRUE;
+    }
+
+    return AvlUserData(NodeToReturn);
+}
+
+
+BOOLEAN
+RtlDeleteElementGenericTableAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID Buffer
+    )
+
+/*++
+
+Routine Description:
+
+    The function DeleteElementGenericTableAvl will find and delete an element
+    from a balanced table.  If the element is located and deleted the return
+    value is TRUE, otherwise if the element is not located the return value
+    is FALSE.  The user supplied input buffer is only used as a key in
+    locating the element in the table.
+
+Arguments:
+
+    Table - Pointer to the table in which to (possibly) delete the
+            memory accessed by the key buffer.
+
+    Buffer - Passed to the user comparasion routine.
+
+Return Value:
+
+    BOOLEAN - If the table contained the key then true, otherwise false.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS NodeToDelete;
+    PRTL_BALANCED_LINKS Successor;
+    PRTL_BALANCED_LINKS Parent;
+    PRTL_BALANCED_LINKS Child;
+    BOOLEAN FromLeft;
+    TABLE_SEARCH_RESULT Lookup;
+
+    Lookup = FindNodeOrParentAvl(
+                 Table,
+                 Buffer,
+                 &NodeToDelete
+                 );
+
+    if (Lookup != TableFoundNode) {
+
+        return FALSE;
+    }
+
+    //
+    //  An enumeration that stopped at this node continues from the node
+    //  before it.
+    //
+
+    if (Table->RestartKey == NodeToDelete) {
+
+        Table->RestartKey = RealPredecessorAvl( Table, NodeToDelete );
+    }
+
+    //
+    //  If the node has two children then move its in order successor,
+    //  which has no left child, into its place in the tree.  After that
+    //  the node to remove from the tree has at most one child.
+    //
+
+    if ((NodeToDelete->LeftChild != NULL) && (NodeToDelete->RightChild != NULL)) {
+
+        Successor = NodeToDelete->RightChild;
+
+        while (Successor->LeftChild != NULL) {
+
+            Successor = Successor->LeftChild;
+        }
+
+        //
+        //  Unlink the successor first, remembering where the tree got
+        //  shorter.
+        //
+
+        if (Successor->Parent == NodeToDelete) {
+
+            Parent = Successor;
+            FromLeft = FALSE;
+
+        } else {
+
+            Parent = Successor->Parent;
+            FromLeft = TRUE;
+
+            Parent->LeftChild = Successor->RightChild;
+            if (Parent->LeftChild != NULL) { Parent->LeftChild->Parent = Parent; }
+
+            Successor->RightChild = NodeToDelete->RightChild;
+            Successor->RightChild->Parent = Successor;
+        }
+
+        Successor->LeftChild = NodeToDelete->LeftChild;
+        Successor->LeftChild->Parent = Successor;
+        Successor->Balance = NodeToDelete->Balance;
+
+        ReplaceChildAvl( NodeToDelete->Parent, NodeToDelete, Successor );
+
+    } else {
+
+        Child = ((NodeToDelete->LeftChild != NULL) ? NodeToDelete->LeftChild
+                                                   : NodeToDelete->RightChild);
+
+        Parent = NodeToDelete->Parent;
+        FromLeft = (BOOLEAN)(Parent->LeftChild == NodeToDelete);
+
+        ReplaceChildAvl( Parent, NodeToDelete, Child );
+    }
+
+    //
+    //  Walk back up the tree from where the height was reduced.  We stop
+    //  as soon as a subtree keeps its height.
+    //
+
+    while (Parent != &Table->BalancedRoot) {
+
+        if (FromLeft) {
+
+            Parent->Balance += 1;
+
+        } else {
+
+            Parent->Balance -= 1;
+        }
+
+        if ((Parent->Balance == 1) || (Parent->Balance == -1)) {
+
+            break;
+        }
+
+        if (Parent->Balance != 0) {
+
+            Parent = RebalanceNodeAvl( Parent );
+
+            if (Parent->Balance != 0) {
+
+                break;
+            }
+        }
+
+        FromLeft = (BOOLEAN)(Parent->Parent->LeftChild == Parent);
+        Parent = Parent->Parent;
+    }
+
+    Table->NumberGenericTableElements--;
+    Table->DeleteCount++;
+
+    Table->OrderedPointer = NULL;
+    Table->WhichOrderedElement = 0;
+
+    //
+    // The node has been deleted from the balanced table.
+    // Now give the node to the user deletion routine.
+    //
+
+    Table->FreeRoutine( Table, NodeToDelete );
+
+    return TRUE;
+}
+
+
+PVOID
+RtlLookupElementGenericTableAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID Buffer
+    )
+
+/*++
+
+Routine Description:
+
+    The function LookupElementGenericTableAvl will find an element in a
+    balanced table.  If the element is located the return value is a pointer
+    to the user defined structure associated with the element, otherwise if
+    the element is not located the return value is NULL.  Unlike the splay
+    tree based table the tree is not modified.
+
+Arguments:
+
+    Table - Pointer to the users balanced table to search for the key.
+
+    Buffer - Used for the comparasion.
+
+Return Value:
+
+    PVOID - returns a pointer to the user data.
+
+--*/
+
+{
+    PVOID NodeOrParent;
+    TABLE_SEARCH_RESULT Lookup;
+
+    return RtlLookupElementGenericTableFullAvl(
+                Table,
+                Buffer,
+                &NodeOrParent,
+                &Lookup
+                );
+}
+
+
+PVOID
+NTAPI
+RtlLookupElementGenericTableFullAvl (
+    PRTL_AVL_TABLE Table,
+    PVOID Buffer,
+    OUT PVOID *NodeOrParent,
+    OUT TABLE_SEARCH_RESULT *SearchResult
+    )
+
+/*++
+
+Routine Description:
+
+    The function LookupElementGenericTableFullAvl will find an element in a
+    balanced table.  If the element is located the return value is a pointer
+    to the user defined structure associated with the element.  If the element
+    is not located then NULL is returned, and NodeOrParent and SearchResult
+    may be passed to RtlInsertElementGenericTableFullAvl.
+
+Arguments:
+
+    Table - Pointer to the users balanced table to search for the key.
+
+    Buffer - Used for the comparasion.
+
+    NodeOrParent - Address to store the desired Node or parent of the desired node.
+
+    SearchResult - Describes the relationship of the NodeOrParent with the desired Node.
+
+Return Value:
+
+    PVOID - returns a pointer to the user data.
+
+--*/
+
+{
+    *SearchResult = FindNodeOrParentAvl(
+                        Table,
+                        Buffer,
+                        (PRTL_BALANCED_LINKS *)NodeOrParent
+                        );
+
+    if (*SearchResult != TableFoundNode) {
+
+        return NULL;
+    }
+
+    return AvlUserData(*NodeOrParent);
+}
+
+
+PVOID
+RtlEnumerateGenericTableAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN BOOLEAN Restart
+    )
+
+/*++
+
+Routine Description:
+
+    The function EnumerateGenericTableAvl will return to the caller one-by-one
+    the elements of of a table in collating order.  The position of the
+    enumeration is kept in the table rather than by restructuring the tree,
+    so the caller must hold the table lock exclusive.  Callers that only
+    hold it shared must use EnumerateGenericTableWithoutSplayingAvl.
+    As an example of its use, to enumerate all of the elements in a table the
+    user would write:
+
+        for (ptr = EnumerateGenericTableAvl(Table,TRUE);
+             ptr != NULL;
+             ptr = EnumerateGenericTableAvl(Table, FALSE)) {
+                :
+        }
+
+Arguments:
+
+    Table - Pointer to the balanced table to enumerate.
+
+    Restart - Flag that if true we should start with the least
+              element in the tree otherwise return the element after
+              the last one returned.
+
+Return Value:
+
+    PVOID - Pointer to the user data.
+
+--*/
+
+{
+    PVOID RestartKey;
+    PVOID UserData;
+
+    RestartKey = (Restart ? NULL : Table->RestartKey);
+
+    UserData = RtlEnumerateGenericTableWithoutSplayingAvl( Table, &RestartKey );
+
+    Table->RestartKey = RestartKey;
+
+    return UserData;
+}
+
+
+PVOID
+RtlEnumerateGenericTableWithoutSplayingAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID *RestartKey
+    )
+
+/*++
+
+Routine Description:
+
+    The function EnumerateGenericTableWithoutSplayingAvl will return to the
+    caller one-by-one the elements of of a table.  The caller keeps the
+    position of the enumeration in RestartKey, so several enumerations of
+    the same table may run at once.
+
+        RestartKey = NULL;
+
+        for (ptr = EnumerateGenericTableWithoutSplayingAvl(Table, &RestartKey);
+             ptr != NULL;
+             ptr = EnumerateGenericTableWithoutSplayingAvl(Table, &RestartKey)) {
+                :
+        }
+
+Arguments:
+
+    Table - Pointer to the balanced table to enumerate.
+
+    RestartKey - Pointer that indicates if we should restart or return the next
+                element.  If the contents of RestartKey is NULL, the search
+                will be started from the beginning.
+
+Return Value:
+
+    PVOID - Pointer to the user data.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS NodeToReturn;
+
+    if (RtlIsGenericTableEmptyAvl(Table)) {
+
+        return NULL;
+    }
+
+    if (*RestartKey == NULL) {
+
+        //
+        // We just loop until we find the leftmost child of the root.
+        //
+
+        for (NodeToReturn = AvlRoot(Table);
+             NodeToReturn->LeftChild != NULL;
+             NodeToReturn = NodeToReturn->LeftChild) {
+
+            NOTHING;
+        }
+
+    } else {
+
+        NodeToReturn = RealSuccessorAvl( Table, *RestartKey );
+    }
+
+    if (NodeToReturn == NULL) {
+
+        return NULL;
+    }
+
+    *RestartKey = NodeToReturn;
+
+    return AvlUserData(NodeToReturn);
+}
+
+
+BOOLEAN
+RtlIsGenericTableEmptyAvl (
+    IN PRTL_AVL_TABLE Table
+    )
+
+/*++
+
+Routine Description:
+
+    The function IsGenericTableEmptyAvl will return to the caller TRUE if
+    the input table is empty (i.e., does not contain any elements) and
+    FALSE otherwise.
+
+Arguments:
+
+    Table - Supplies a pointer to the balanced table.
+
+Return Value:
+
+    BOOLEAN - if enabled the tree is empty.
+
+--*/
+
+{
+    return ((AvlRoot(Table) == NULL) ? TRUE : FALSE);
+}
+
+
+PVOID
+RtlGetElementGenericTableAvl (
+    IN PRTL_AVL_TABLE Table,
+    IN ULONG I
+    )
+
+/*++
+
+Routine Description:
+
+    The function GetElementGenericTableAvl will return the i'th element
+    of the balanced table in collating order.  I = 0 implies the first
+    element, I = (RtlNumberGenericTableElementsAvl(Table)-1) will return
+    the last element.  Values of I > than
+    (NumberGenericTableElementsAvl(Table)-1) will return NULL.
+
+    The last element returned is remembered, so stepping through the
+    table by increasing or decreasing I only walks one node each time.
+    Because this updates the table the caller must hold the table lock
+    exclusive.
+
+Arguments:
+
+    Table - Pointer to the balanced table from which to get the ith element.
+
+    I - Which element to get.
+
+Return Value:
+
+    PVOID - Pointer to the user data.
+
+--*/
+
+{
+    PRTL_BALANCED_LINKS CurrentNode;
+    ULONG CurrentLocation;
+
+    if (I >= Table->NumberGenericTableElements) {
+
+        return NULL;
+    }
+
+    //
+    //  Start from the remembered element if there is one and it is closer
+    //  than the first element, otherwise start from the first element.
+    //
+
+    CurrentNode = Table->OrderedPointer;
+    CurrentLocation = Table->WhichOrderedElement;
+
+    if ((CurrentNode == NULL) || (I < (CurrentLocation / 2))) {
+
+        for (CurrentNode = AvlRoot(Table);
+             CurrentNode->LeftChild != NULL;
+             CurrentNode = CurrentNode->LeftChild) {
+
+            NOTHING;
+        }
+
+        CurrentLocation = 0;
+    }
+
+    while (CurrentLocation < I) {
+
+        CurrentNode = RealSuccessorAvl( Table, CurrentNode );
+        CurrentLocation += 1;
+    }
+
+    while (CurrentLocation > I) {
+
+        CurrentNode = RealPredecessorAvl( Table, CurrentNode );
+        CurrentLocation -= 1;
+    }
+
+    Table->OrderedPointer = CurrentNode;
+    Table->WhichOrderedElement = CurrentLocation;
+
+    return AvlUserData(CurrentNode);
+}
+
+
+ULONG
+RtlNumberGenericTableElementsAvl (
+    IN PRTL_AVL_TABLE Table
+    )
+
+/*++
+
+Routine Description:
+
+    The function NumberGenericTableElementsAvl returns a ULONG value
+    which is the number of elements currently inserted in the balanced
+    table.
+
+Arguments:
+
+    Table - Pointer to the balanced table from which to find out the number
+    of elements.
+
+Return Value:
+
+    ULONG - The number of elements in the balanced table.
+
+--*/
+
+{
+    return Table->NumberGenericTableElements;
+}
@@ -214,6 +214,86 @@ static CONST UCHAR FillMask[] = { 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F
 
 static CONST UCHAR ZeroMask[] = { 0xFF, 0xFE, 0xFC, 0xF8, 0xf0, 0xe0, 0xc0, 0x80, 0x00 };
 
+//
+//  Local support routines for examining the bitmap a ulong at a time
+//
+
+static ULONG
+RtlpBitsSetInUlong (
+    IN ULONG Ulong
+    )
+
+/*++
+
+Routine Description:
+
+    This routine returns the number of bits set in a ulong by summing
+    adjacent bit fields in parallel, instead of doing four byte lookups.
+
+Arguments:
+
+    Ulong - Supplies the value to count.
+
+Return Value:
+
+    ULONG - The number of bits set in Ulong.
+
+--*/
+
+{
+    Ulong = Ulong - ((Ulong >> 1) & 0x55555555);
+    Ulong = (Ulong & 0x33333333) + ((Ulong >> 2) & 0x33333333);
+    Ulong = (Ulong + (Ulong >> 4)) & 0x0f0f0f0f;
+
+    return (Ulong * 0x01010101) >> 24;
+}
+
+static ULONG
+RtlpSkipSetUlongs (
+    IN PRTL_BITMAP BitMapHeader,
+    IN ULONG ByteIndex,
+    IN ULONG EndByteIndex
+    )
+
+/*++
+
+Routine Description:
+
+    This routine steps over ulongs that are completely set, none of which
+    can hold any part of a clear run.  Only ulongs that lie wholly before
+    EndByteIndex are examined.
+
+Arguments:
+
+    BitMapHeader - Supplies a pointer to the previously initialized bitmap.
+
+    ByteIndex - Supplies the ulong aligned byte index to start from.
+
+    EndByteIndex - Supplies the byte index at which to stop.
+
+Return Value:
+
+    ULONG - The byte index of the first ulong that is not completely set,
+        or the first one that does not fit before EndByteIndex.
+
+--*/
+
+{
+    PULONG Buffer;
+
+    ASSERT((ByteIndex % sizeof(ULONG)) == 0);
+
+    Buffer = BitMapHeader->Buffer;
+
+    while (((ByteIndex + sizeof(ULONG)) <= EndByteIndex) &&
+           (Buffer[ByteIndex / sizeof(ULONG)] == 0xffffffff)) {
+
+        ByteIndex += sizeof(ULONG);
+    }
+
+    return ByteIndex;
+}
+
 
 VOID
 RtlInitializeBitMap (
@@ -610,6 +690,22 @@ Return Value:
 
                 CurrentBitIndex += 8;
 
+                //
+                //  If we have just finished a set byte at the end of a ulong
+                //  then skip over any following ulongs that are also all set.
+                //  They cannot satisfy the request and leave the previous
+                //  byte as all ones.
+                //
+
+                if ((PreviousByte == 0xff) && ((CurrentBitIndex % 32) == 0)) {
+
+                    CurrentBitIndex = RtlpSkipSetUlongs( BitMapHeader,
+                                                         CurrentBitIndex / 8,
+                                                         EndByteIndex ) * 8;
+
+                    GET_BYTE_INITIALIZATION( BitMapHeader, CurrentBitIndex / 8 );
+                }
+
                 if ( CurrentBitIndex < EndByteIndex * 8 ) {
 
                     GET_BYTE( CurrentByte );
@@ -661,6 +757,28 @@ Return Value:
 
                 CurrentBitIndex += 8;
 
+                //
+                //  Skip any completely set ulongs that follow a set byte, the
+                //  same way as the small run case above.
+                //
+
+                if ((PreviousByte == 0xff) && ((CurrentBitIndex % 32) == 0)) {
+
+                    ULONG NextBitIndex;
+
+                    NextBitIndex = RtlpSkipSetUlongs( BitMapHeader,
+                                                      CurrentBitIndex / 8,
+                                                      EndByteIndex ) * 8;
+
+                    if (NextBitIndex != CurrentBitIndex) {
+
+                        PreviousPreviousByte = 0xff;
+                        CurrentBitIndex = NextBitIndex;
+
+                        GET_BYTE_INITIALIZATION( BitMapHeader, CurrentBitIndex / 8 );
+                    }
+                }
+
                 if ( CurrentBitIndex < EndByteIndex * 8 ) {
 
                     GET_BYTE( CurrentByte );
@@ -841,6 +959,29 @@ Return Value:
 
                 CurrentByteIndex += 1;
 
+                //
+                //  A run this long needs at least one clear byte, so if we
+                //  are starting a new ulong just after a set byte we can skip
+                //  over every following ulong that is all set.
+                //
+
+                if ((CurrentByte == 0xff) && ((CurrentByteIndex % sizeof(ULONG)) == 0)) {
+
+                    ULONG NextByteIndex;
+
+                    NextByteIndex = RtlpSkipSetUlongs( BitMapHeader,
+                                                       CurrentByteIndex,
+                                                       EndByteIndex );
+
+                    if (NextByteIndex != CurrentByteIndex) {
+
+                        StartOfRunIndex = NextByteIndex - 1;
+                        CurrentByteIndex = NextByteIndex;
+
+                        GET_BYTE_INITIALIZATION( BitMapHeader, CurrentByteIndex );
+                    }
+                }
+
                 if ( CurrentByteIndex < EndByteIndex ) {
 
                     GET_BYTE( CurrentByte );
@@ -1863,6 +2004,38 @@ Return Value:
          CurrentByteIndex < SizeInBytes;
          CurrentByteIndex += 1) {
 
+        //
+        //  At the start of each whole ulong check if it is all clear or
+        //  all set, because then we can account for all 32 bits at once.
+        //  A clear ulong simply extends the current run.  A set ulong with
+        //  no open run moves the start of the next run past it.
+        //
+
+        if (((CurrentByteIndex % sizeof(ULONG)) == 0) &&
+            ((CurrentByteIndex + sizeof(ULONG)) <= SizeInBytes)) {
+
+            ULONG CurrentUlong;
+
+            CurrentUlong = BitMapHeader->Buffer[CurrentByteIndex / sizeof(ULONG)];
+
+            if ((CurrentUlong == 0) ||
+                ((CurrentUlong == 0xffffffff) && (CurrentRunSize == 0))) {
+
+                if (CurrentUlong == 0) {
+
+                    CurrentRunSize += 32;
+
+                } else {
+
+                    CurrentRunIndex = (CurrentByteIndex + sizeof(ULONG)) * 8;
+                }
+
+                GET_BYTE_INITIALIZATION( BitMapHeader, CurrentByteIndex + sizeof(ULONG) );
+                CurrentByteIndex += sizeof(ULONG) - 1;
+                continue;
+            }
+        }
+
         GET_BYTE( CurrentByte );
 
 #if DBG
@@ -2202,17 +2375,23 @@ Return Value:
     }
 
     //
-    //  Set if up so we can use the GET_BYTE macro
+    //  Count the whole ulongs first, and then set it up so we can use the
+    //  GET_BYTE macro for any remaining bytes
     //
 
-    GET_BYTE_INITIALIZATION( BitMapHeader, 0 );
+    TotalClear = 0;
+    for (i = 0; i < SizeInBytes / sizeof(ULONG); i += 1) {
+
+        TotalClear += 32 - RtlpBitsSetInUlong( BitMapHeader->Buffer[i] );
+    }
+
+    GET_BYTE_INITIALIZATION( BitMapHeader, i * sizeof(ULONG) );
 
     //
-    //  Examine every byte in the bitmap
+    //  Examine every remaining byte in the bitmap
     //
 
-    TotalClear = 0;
-    for (i = 0; i < SizeInBytes; i += 1) {
+    for (i = i * sizeof(ULONG); i < SizeInBytes; i += 1) {
 
         GET_BYTE( CurrentByte );
 
@@ -2280,17 +2459,23 @@ Return Value:
     }
 
     //
-    //  Set if up so we can use the GET_BYTE macro
+    //  Count the whole ulongs first, and then set it up so we can use the
+    //  GET_BYTE macro for any remaining bytes
     //
 
-    GET_BYTE_INITIALIZATION( BitMapHeader, 0 );
+    TotalSet = 0;
+    for (i = 0; i < SizeInBytes / sizeof(ULONG); i += 1) {
+
+        TotalSet += RtlpBitsSetInUlong( BitMapHeader->Buffer[i] );
+    }
+
+    GET_BYTE_INITIALIZATION( BitMapHeader, i * sizeof(ULONG) );
 
     //
-    //  Examine every byte in the bitmap
+    //  Examine every remaining byte in the bitmap
     //
 
-    TotalSet = 0;
-    for (i = 0; i < SizeInBytes; i += 1) {
+    for (i = i * sizeof(ULONG); i < SizeInBytes; i += 1) {
 
         GET_BYTE( CurrentByte );
 
@@ -1095,23 +1095,38 @@ Return Value:
     //  But the caller asked for no serialize or asked for non growable
     //  heap then we won't enable the lookaside lists.
     //
+    //  On a multiprocessor we give each heap one lookaside slot per
+    //  processor, rounded up to a power of two, so that threads on
+    //  different processors mostly use different list heads.
+    //
 
     Heap->Lookaside = NULL;
     Heap->LookasideLockCount = 0;
+    Heap->LookasideSlotMask = 0;
 
     if ((!(Flags & HEAP_NO_SERIALIZE)) &&
         ( (Flags & HEAP_GROWABLE)) &&
         (!(RtlpDisableHeapLookaside))) {
 
         ULONG i;
+        ULONG Slots;
+
+        for (Slots = 1;
+             (Slots < Peb->NumberOfProcessors) && (Slots < HEAP_MAXIMUM_LOOKASIDE_SLOTS);
+             Slots <<= 1) {
+
+            NOTHING;
+        }
 
         Heap->Lookaside = RtlAllocateHeap( Heap,
                                            Flags,
-                                           sizeof(HEAP_LOOKASIDE) * HEAP_MAXIMUM_FREELISTS );
+                                           sizeof(HEAP_LOOKASIDE) * HEAP_MAXIMUM_FREELISTS * Slots );
 
         if (Heap->Lookaside != NULL) {
 
-            for (i = 0; i < HEAP_MAXIMUM_FREELISTS; i += 1) {
+            Heap->LookasideSlotMask = Slots - 1;
+
+            for (i = 0; i < HEAP_MAXIMUM_FREELISTS * Slots; i += 1) {
 
                 RtlpInitializeHeapLookaside( &(((PHEAP_LOOKASIDE)(Heap->Lookaside))[i]),
                                              32 );
@@ -1454,6 +1469,8 @@ Return Value:
             (Heap->LookasideLockCount == 0) &&
             (AllocationIndex < HEAP_MAXIMUM_FREELISTS)) {
 
+            Lookaside = RtlpGetThreadHeapLookaside( Heap, Lookaside );
+
             //
             //  If the number of operation elapsed operations is 128 times the
             //  lookaside depth then it is time to adjust the depth
@@ -3068,6 +3085,8 @@ Return Value:
             (!(BusyBlock->Flags & HEAP_ENTRY_VIRTUAL_ALLOC)) &&
             ((FreeSize = BusyBlock->Size) < HEAP_MAXIMUM_FREELISTS)) {
 
+            Lookaside = RtlpGetThreadHeapLookaside( Heap, Lookaside );
+
             if (RtlpFreeToHeapLookaside( &Lookaside[FreeSize], BaseAddress)) {
 
                 return TRUE;
@@ -67,6 +67,7 @@ const struct {
     FIELD_OFFSET( HEAP, LockVariable ),                 "LockVariable",
     FIELD_OFFSET( HEAP, Lookaside ),                    "Lookaside",
     FIELD_OFFSET( HEAP, LookasideLockCount ),           "LookasideLockCount",
+    FIELD_OFFSET( HEAP, LookasideSlotMask ),            "LookasideSlotMask",
     sizeof( HEAP ),                                     "Uncommitted Ranges",
     0xFFFF, NULL
 };
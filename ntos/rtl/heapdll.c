@@ -2598,7 +2598,7 @@ Return Value:
 
                     Heap->Lookaside = NULL;
 
-                    for (i = 0; i < HEAP_MAXIMUM_FREELISTS; i += 1) {
+                    for (i = 0; i < HEAP_MAXIMUM_FREELISTS * (Heap->LookasideSlotMask + 1); i += 1) {
 
                         while ((Block = RtlpAllocateFromHeapLookaside(&(Lookaside[i]))) != NULL) {
 
@@ -3795,7 +3795,7 @@ Return Value:
 
             Heap->Lookaside = NULL;
 
-            for (i = 0; i < HEAP_MAXIMUM_FREELISTS; i += 1) {
+            for (i = 0; i < HEAP_MAXIMUM_FREELISTS * (Heap->LookasideSlotMask + 1); i += 1) {
 
                 while ((Block = RtlpAllocateFromHeapLookaside(&(Lookaside[i]))) != NULL) {
 
@@ -627,6 +627,19 @@ typedef struct _HEAP_LOOKASIDE {
 
 } HEAP_LOOKASIDE, *PHEAP_LOOKASIDE;
 
+//
+//  Define the maximum number of lookaside slots per heap, and a macro
+//  that returns the lookaside lists the current thread should use.  The
+//  low two bits of a thread id are always zero.
+//
+
+#define HEAP_MAXIMUM_LOOKASIDE_SLOTS 8
+
+#define RtlpGetThreadHeapLookaside(H,L) (                                     \
+    &(L)[((HandleToUlong(NtCurrentTeb()->ClientId.UniqueThread) >> 2) &       \
+          (H)->LookasideSlotMask) * HEAP_MAXIMUM_FREELISTS]                   \
+    )
+
 NTKERNELAPI
 VOID
 RtlpInitializeHeapLookaside (
@@ -0,0 +1,224 @@
+/*++
+
+Copyright (c) 1989  Microsoft Corporation
+
+Module Name:
+
+    tavltbl.c
+
+Abstract:
+
+    Test program for the balanced generic table procedures
+
+Author:
+
+Revision History:
+
+--*/
+
+#include <stdio.h>
+
+#include "ntrtlp.h"
+
+ULONG RtlRandom ( IN OUT PULONG Seed );
+
+#define NUMBER_OF_KEYS 512
+
+RTL_AVL_TABLE Table;
+
+//
+//  Records which keys are currently in the table.
+//
+
+BOOLEAN Present[NUMBER_OF_KEYS];
+
+//
+//  Storage for the table nodes, handed out by the allocate routine.
+//
+
+ULONG NodeBuffer[NUMBER_OF_KEYS*2][16];
+ULONG NextNode;
+
+RTL_GENERIC_COMPARE_RESULTS
+NTAPI
+CompareKeys (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID FirstStruct,
+    IN PVOID SecondStruct
+    )
+
+{
+    ULONG First = *(PULONG)FirstStruct;
+    ULONG Second = *(PULONG)SecondStruct;
+
+    if (First < Second) { return GenericLessThan; }
+    if (First > Second) { return GenericGreaterThan; }
+    return GenericEqual;
+}
+
+PVOID
+NTAPI
+AllocateNode (
+    IN PRTL_AVL_TABLE Table,
+    IN CLONG ByteSize
+    )
+
+{
+    if ((NextNode >= NUMBER_OF_KEYS*2) || (ByteSize > sizeof(NodeBuffer[0]))) {
+
+        return NULL;
+    }
+
+    return NodeBuffer[NextNode++];
+}
+
+VOID
+NTAPI
+FreeNode (
+    IN PRTL_AVL_TABLE Table,
+    IN PVOID Buffer
+    )
+
+{
+    return;
+}
+
+LONG
+CheckTree (
+    IN PRTL_BALANCED_LINKS Links
+    )
+
+//
+//  Returns the height of the subtree, or -1 if the subtree is not
+//  correctly balanced.
+//
+
+{
+    LONG Left, Right;
+
+    if (Links == NULL) { return 0; }
+
+    Left = CheckTree( Links->LeftChild );
+    Right = CheckTree( Links->RightChild );
+
+    if ((Left < 0) || (Right < 0)) { return -1; }
+    if ((Links->LeftChild != NULL) && (Links->LeftChild->Parent != Links)) { return -1; }
+    if ((Links->RightChild != NULL) && (Links->RightChild->Parent != Links)) { return -1; }
+    if ((Right - Left) != Links->Balance) { return -1; }
+    if ((Right - Left > 1) || (Left - Right > 1)) { return -1; }
+
+    return 1 + ((Left > Right) ? Left : Right);
+}
+
+int
+_CDECL
+main(
+    int argc,
+    char *argv[]
+    )
+{
+    ULONG i;
+    ULONG Key;
+    ULONG Seed;
+    ULONG Count;
+    PULONG Element;
+    PVOID RestartKey;
+    BOOLEAN NewElement;
+
+    DbgPrint("Start AvlTableTest()\n");
+
+    RtlInitializeGenericTableAvl( &Table, CompareKeys, AllocateNode, FreeNode, NULL );
+
+    if (!RtlIsGenericTableEmptyAvl( &Table )) { DbgPrint("IsGenericTableEmpty Error 1\n"); }
+
+    //
+    //  Insert and delete random keys, checking the shape of the tree as we go
+    //
+
+    Count = 0;
+    Seed = 0;
+
+    for (i = 0; i < NUMBER_OF_KEYS*2; i++) {
+
+        Key = RtlRandom(&Seed) % NUMBER_OF_KEYS;
+
+        if ((i % 3) != 2) {
+
+            Element = RtlInsertElementGenericTableAvl( &Table, &Key, sizeof(ULONG), &NewElement );
+
+            if ((Element == NULL) || (*Element != Key) || (NewElement == Present[Key])) {
+
+                DbgPrint("InsertElement Error %u\n", Key);
+                return FALSE;
+            }
+
+            if (NewElement) { Present[Key] = TRUE; Count += 1; }
+
+        } else {
+
+            if (RtlDeleteElementGenericTableAvl( &Table, &Key ) != Present[Key]) {
+
+                DbgPrint("DeleteElement Error %u\n", Key);
+                return FALSE;
+            }
+
+            if (Present[Key]) { Present[Key] = FALSE; Count -= 1; }
+        }
+
+        if (CheckTree( Table.BalancedRoot.RightChild ) < 0) {
+
+            DbgPrint("Tree not balanced after %u operations\n", i + 1);
+            return FALSE;
+        }
+    }
+
+    if (RtlNumberGenericTableElementsAvl( &Table ) != Count) { DbgPrint("NumberGenericTableElements Error\n"); }
+
+    //
+    //  Lookups must find exactly the keys that are present
+    //
+
+    for (Key = 0; Key < NUMBER_OF_KEYS; Key++) {
+
+        Element = RtlLookupElementGenericTableAvl( &Table, &Key );
+
+        if ((Element != NULL) != Present[Key]) {
+
+            DbgPrint("LookupElement Error %u\n", Key);
+            return FALSE;
+        }
+    }
+
+    //
+    //  Both kinds of enumeration and the ordinal lookup must return the keys
+    //  in order
+    //
+
+    RestartKey = NULL;
+    Key = 0;
+    i = 0;
+
+    for (Element = RtlEnumerateGenericTableAvl( &Table, TRUE );
+         Element != NULL;
+         Element = RtlEnumerateGenericTableAvl( &Table, FALSE )) {
+
+        while (!Present[Key]) { Key++; }
+
+        if ((*Element != Key) ||
+            (RtlEnumerateGenericTableWithoutSplayingAvl( &Table, &RestartKey ) != Element) ||
+            (RtlGetElementGenericTableAvl( &Table, i ) != Element)) {
+
+            DbgPrint("EnumerateGenericTable Error %u\n", Key);
+            return FALSE;
+        }
+
+        Key++;
+        i++;
+    }
+
+    if (i != Count) { DbgPrint("EnumerateGenericTable Count Error\n"); }
+
+    DbgPrint("End AvlTableTest()\n");
+
+    return TRUE;
+}
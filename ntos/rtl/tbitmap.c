@@ -477,6 +477,56 @@ main(
     RtlSetBits( BitMap, 10, 1 );
     if (!RtlAreBitsSet( BitMap, 10, 1 )) { DbgPrint("AreBitsSet Error 36\n"); }
 
+    //
+    //  Now test runs that cover whole ulongs, which are counted and skipped
+    //  a ulong at a time
+    //
+
+    {
+        RTL_BITMAP_RUN RunArray[4];
+
+        RtlSetAllBits( BitMap );
+        RtlClearBits( BitMap, 30 + 20*32, 2 + 3*32 + 5 );
+        RtlClearBits( BitMap,  0 + 40*32, 128 );
+        RtlClearBits( BitMap, 17 + 60*32, 1 );
+
+        if (RtlNumberOfClearBits( BitMap ) != 2 + 3*32 + 5 + 128 + 1) { DbgPrint("Number of Clear bits error 4\n" ); }
+        if (RtlNumberOfSetBits( BitMap ) != 2048*8 - (2 + 3*32 + 5 + 128 + 1)) { DbgPrint("Number of Set bits error 4\n" ); }
+
+        if (RtlFindClearBits( BitMap, 1, 0 ) != 30 + 20*32) { DbgPrint("FindClearBits Error 1\n"); }
+        if (RtlFindClearBits( BitMap, 14, 0 ) != 30 + 20*32) { DbgPrint("FindClearBits Error 2\n"); }
+        if (RtlFindClearBits( BitMap, 100, 0 ) != 30 + 20*32) { DbgPrint("FindClearBits Error 3\n"); }
+        if (RtlFindClearBits( BitMap, 104, 0 ) != 0 + 40*32) { DbgPrint("FindClearBits Error 4\n"); }
+        if (RtlFindClearBits( BitMap, 1, 30*32 ) != 0 + 40*32) { DbgPrint("FindClearBits Error 5\n"); }
+        if (RtlFindClearBits( BitMap, 1, 50*32 ) != 17 + 60*32) { DbgPrint("FindClearBits Error 6\n"); }
+        if (RtlFindClearBits( BitMap, 2, 50*32 ) != 30 + 20*32) { DbgPrint("FindClearBits Error 7\n"); }
+        if (RtlFindClearBits( BitMap, 65, 0 ) != 30 + 20*32) { DbgPrint("FindClearBits Error 8\n"); }
+        if (RtlFindClearBits( BitMap, 129, 0 ) != 0xffffffff) { DbgPrint("FindClearBits Error 9\n"); }
+
+        if ((RtlFindClearRuns( BitMap, RunArray, 4, TRUE ) != 3) ||
+            (RunArray[0].StartingIndex != 0 + 40*32) || (RunArray[0].NumberOfBits != 128) ||
+            (RunArray[1].StartingIndex != 30 + 20*32) || (RunArray[1].NumberOfBits != 2 + 3*32 + 5) ||
+            (RunArray[2].StartingIndex != 17 + 60*32) || (RunArray[2].NumberOfBits != 1)) {
+
+            DbgPrint("FindClearRuns Error 1\n");
+        }
+
+        //
+        //  A bitmap whose size is not a multiple of a ulong must not count the
+        //  bits past its end
+        //
+
+        RtlInitializeBitMap( BitMap, Buffer, 100*32 + 13 );
+        RtlClearAllBits( BitMap );
+        Buffer[100] = 0;
+
+        if (RtlNumberOfClearBits( BitMap ) != 100*32 + 13) { DbgPrint("Number of Clear bits error 5\n" ); }
+        if (RtlFindClearBits( BitMap, 100*32 + 13, 0 ) != 0) { DbgPrint("FindClearBits Error 10\n"); }
+        if (RtlFindClearBits( BitMap, 100*32 + 14, 0 ) != 0xffffffff) { DbgPrint("FindClearBits Error 11\n"); }
+
+        RtlInitializeBitMap( BitMap, Buffer, 2048*8 );
+    }
+
     DbgPrint("End BitMapTest()\n");
 
     return TRUE;